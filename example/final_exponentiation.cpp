@@ -0,0 +1,131 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+using namespace nil::crypto3::algebra;
+
+typedef curves::bls12<381> curve_type;
+typedef curve_type::gt_type::value_type gt_value_type;
+typedef pairing::detail::bls12_basic_policy<381> policy_type;
+
+gt_value_type exp_by_z(const gt_value_type &elt) {
+    static const fields::detail::cyclotomic_wnaf_exponent z(policy_type::final_exponent_z);
+
+    gt_value_type result = elt.cyclotomic_exp(z);
+    if (policy_type::final_exponent_is_z_neg) {
+        result = result.unitary_inversed();
+    }
+
+    return result;
+}
+
+gt_value_type easy_part(const gt_value_type &elt) {
+    const gt_value_type C = elt.unitary_inversed() * elt.inversed();
+    return C.Frobenius_map(2) * C;
+}
+
+// The hard part used before the Hayashida-Hayasaka-Teruya chain: five exponentiations by z,
+// ten Fp12 multiplications, two cyclotomic squarings and three Frobenius maps.
+gt_value_type old_hard_part(const gt_value_type &elt) {
+    const gt_value_type A = elt.cyclotomic_squared();
+    const gt_value_type B = A.unitary_inversed();
+    const gt_value_type C = exp_by_z(elt);
+    const gt_value_type D = C.cyclotomic_squared();
+    const gt_value_type E = B * C;
+    const gt_value_type F = exp_by_z(E);
+    const gt_value_type G = exp_by_z(F);
+    const gt_value_type H = exp_by_z(G);
+    const gt_value_type I = H * D;
+    const gt_value_type J = exp_by_z(I);
+    const gt_value_type K = E.unitary_inversed();
+    const gt_value_type L = K * J;
+    const gt_value_type M = elt * L;
+    const gt_value_type N = elt.unitary_inversed();
+    const gt_value_type O = F * elt;
+    const gt_value_type P = O.Frobenius_map(3);
+    const gt_value_type Q = I * N;
+    const gt_value_type R = Q.Frobenius_map(1);
+    const gt_value_type S = C * G;
+    const gt_value_type T = S.Frobenius_map(2);
+    const gt_value_type U = T * P;
+    const gt_value_type V = U * R;
+
+    return V * M;
+}
+
+template<typename Function>
+double time_per_call(const std::vector<gt_value_type> &inputs, std::vector<gt_value_type> &outputs, Function f) {
+    const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < inputs.size(); ++i) {
+        outputs[i] = f(inputs[i]);
+    }
+    const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::micro>(end - begin).count() / inputs.size();
+}
+
+// Usage: final_exponentiation [number of Miller loop outputs]
+// Compares the BLS12-381 final exponentiation against the previous hard part chain. The new hard part is
+// timed as the whole final exponentiation minus the easy part, since the chain itself is not public.
+int main(int argc, char *argv[]) {
+    const std::size_t n = argc > 1 ? std::stoul(argv[1]) : 100;
+
+    std::vector<gt_value_type> inputs;
+    for (std::size_t i = 0; i < n; ++i) {
+        inputs.push_back(curve_type::pairing::pair(random_element<curve_type::g1_type>(),
+                                                   random_element<curve_type::g2_type>()));
+    }
+
+    std::vector<gt_value_type> easy(n), old_result(n), new_result(n);
+
+    const double easy_us = time_per_call(inputs, easy, easy_part);
+    const double old_us = time_per_call(easy, old_result, old_hard_part);
+    const double new_us = time_per_call(inputs, new_result, [](const gt_value_type &elt) {
+        return curve_type::pairing::final_exponentiation(elt);
+    });
+
+    for (std::size_t i = 0; i < n; ++i) {
+        if (old_result[i] != new_result[i]) {
+            std::cout << "Mismatch between the hard parts at input " << i << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::cout << "BLS12-381 final exponentiation, " << n << " inputs, us per call:" << std::endl;
+    std::cout << "\teasy part:      " << easy_us << std::endl;
+    std::cout << "\told hard part:  " << old_us << std::endl;
+    std::cout << "\tnew hard part:  " << new_us - easy_us << std::endl;
+    std::cout << "\told total:      " << easy_us + old_us << std::endl;
+    std::cout << "\tnew total:      " << new_us << std::endl;
+
+    return 0;
+}
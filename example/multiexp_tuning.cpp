@@ -0,0 +1,80 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/mnt4.hpp>
+#include <nil/crypto3/algebra/curves/mnt6.hpp>
+
+#include <nil/crypto3/algebra/multiexp/calibration.hpp>
+#include <nil/crypto3/algebra/multiexp/tuning.hpp>
+
+using namespace nil::crypto3::algebra;
+
+template<typename GroupType>
+void calibrate_group(const std::string &name,
+                     std::size_t max_log_size,
+                     std::vector<std::pair<std::string, multiexp_tuning_profile>> &profiles) {
+    std::cout << "Calibrating " << name << "..." << std::endl;
+
+    multiexp_tuning_profile profile = calibrate_multiexp<GroupType>(max_log_size);
+    for (const multiexp_tuning_range &range : profile.ranges) {
+        std::cout << "\tsize >= " << range.min_size << ": " << detail::multiexp_method_name(range.method);
+        if (range.method == multiexp_method_type::BDLO12) {
+            std::cout << ", window " << range.window;
+        }
+        std::cout << std::endl;
+    }
+
+    profiles.emplace_back(multiexp_tuning<GroupType>::key(), profile);
+}
+
+// Usage: multiexp_tuning [profile path] [log2 of the largest instance]
+// Point CRYPTO3_MULTIEXP_PROFILE to the written file to use it.
+int main(int argc, char *argv[]) {
+    const std::string path = argc > 1 ? argv[1] : "multiexp_profile.txt";
+    const std::size_t max_log_size = argc > 2 ? std::stoul(argv[2]) : 16;
+
+    std::vector<std::pair<std::string, multiexp_tuning_profile>> profiles;
+
+    calibrate_group<curves::bls12<381>::g1_type>("BLS12-381 G1", max_log_size, profiles);
+    calibrate_group<curves::bls12<381>::g2_type>("BLS12-381 G2", max_log_size, profiles);
+    calibrate_group<curves::alt_bn128<254>::g1_type>("ALT_BN128-254 G1", max_log_size, profiles);
+    calibrate_group<curves::alt_bn128<254>::g2_type>("ALT_BN128-254 G2", max_log_size, profiles);
+    calibrate_group<curves::mnt4<298>::g1_type>("MNT4-298 G1", max_log_size, profiles);
+    calibrate_group<curves::mnt6<298>::g1_type>("MNT6-298 G1", max_log_size, profiles);
+
+    std::ofstream file(path);
+    write_multiexp_tuning_profiles(file, profiles);
+
+    std::cout << "Profile written to " << path << std::endl;
+
+    return 0;
+}
@@ -26,6 +26,18 @@
 #ifndef CRYPTO3_ALGEBRA_PAIRING_ALGORITHM_HPP
 #define CRYPTO3_ALGEBRA_PAIRING_ALGORITHM_HPP
 
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/detail/parallel.hpp>
+
+#include <nil/crypto3/algebra/fields/detail/batch_inversion.hpp>
+#include <nil/crypto3/algebra/pairing/g2_precomp_cache.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace algebra {
@@ -81,6 +93,28 @@ namespace nil {
                 return PairingCurveType::pairing::pair_reduced(v1, v2);
             }
 
+            /**
+             * Same as pair, with the precomputation of v2 taken from (or added to) cache.
+             */
+            template<typename PairingCurveType>
+            typename PairingCurveType::pairing::gt_type::value_type
+                pair(const typename PairingCurveType::pairing::g1_type::value_type &v1,
+                     const typename PairingCurveType::pairing::g2_type::value_type &v2,
+                     pairing::g2_precomp_cache<PairingCurveType> &cache) {
+
+                return PairingCurveType::pairing::miller_loop(PairingCurveType::pairing::precompute_g1(v1),
+                                                              *cache.get(v2));
+            }
+
+            template<typename PairingCurveType>
+            typename PairingCurveType::pairing::gt_type::value_type
+                pair_reduced(const typename PairingCurveType::pairing::g1_type::value_type &v1,
+                             const typename PairingCurveType::pairing::g2_type::value_type &v2,
+                             pairing::g2_precomp_cache<PairingCurveType> &cache) {
+
+                return PairingCurveType::pairing::final_exponentiation(pair<PairingCurveType>(v1, v2, cache));
+            }
+
             template<typename PairingCurveType>
             typename PairingCurveType::pairing::gt_type::value_type
                 double_miller_loop(const typename PairingCurveType::pairing::g1_precomp &prec_P1,
@@ -98,6 +132,28 @@ namespace nil {
                 return PairingCurveType::pairing::final_exponentiation(elt);
             }
 
+            /**
+             * Replaces every element of [first, last) by its final exponentiation. The inversions needed by
+             * the easy parts are shared across the range with a single batch inversion (Montgomery's trick),
+             * and with thread_count != 1 the remaining, inversion-free work is spread over several threads.
+             * All elements are required to be non-zero, which holds for Miller loop outputs.
+             */
+            template<typename PairingCurveType, typename GTIterator>
+            void batch_final_exponentiation(GTIterator first, GTIterator last, std::size_t thread_count = 1) {
+                typedef typename PairingCurveType::pairing::gt_type::value_type gt_value_type;
+
+                std::vector<gt_value_type> inverses(first, last);
+                fields::detail::batch_inversion(inverses.begin(), inverses.end());
+
+                nil::crypto3::detail::parallel_for(
+                    inverses.size(), thread_count, [&](std::size_t begin, std::size_t end) {
+                        GTIterator it = std::next(first, begin);
+                        for (std::size_t i = begin; i < end; ++i, ++it) {
+                            *it = PairingCurveType::pairing::final_exponentiation(*it, inverses[i]);
+                        }
+                    });
+            }
+
             template<typename PairingCurveType>
             typename PairingCurveType::pairing::gt_type::value_type
                 miller_loop(const typename PairingCurveType::pairing::g1_precomp &prec_P,
@@ -105,6 +161,150 @@ namespace nil {
 
                 return PairingCurveType::pairing::miller_loop(prec_P, prec_Q);
             }
+
+            /**
+             * Product of the Miller loops of all (prec_P[i], prec_Q[i]) pairs, sharing the squarings of
+             * the accumulator between the pairs.
+             */
+            template<typename PairingCurveType>
+            typename PairingCurveType::pairing::gt_type::value_type
+                multi_miller_loop(const std::vector<typename PairingCurveType::pairing::g1_precomp> &prec_P,
+                                  const std::vector<typename PairingCurveType::pairing::g2_precomp> &prec_Q) {
+
+                return PairingCurveType::pairing::multi_miller_loop(prec_P, prec_Q);
+            }
+
+            template<typename PairingCurveType>
+            bool pairing_product_is_one(const std::vector<typename PairingCurveType::pairing::g1_precomp> &prec_P,
+                                        const std::vector<typename PairingCurveType::pairing::g2_precomp> &prec_Q) {
+
+                return PairingCurveType::pairing::pairing_product_is_one(prec_P, prec_Q);
+            }
+
+            namespace detail {
+                /**
+                 * G2 precomputation for parallel_miller_loop_product when no cache is involved.
+                 */
+                template<typename PairingCurveType>
+                struct shared_precompute_g2 {
+                    typedef typename PairingCurveType::pairing pairing_policy;
+
+                    std::shared_ptr<const typename pairing_policy::g2_precomp>
+                        operator()(const typename pairing_policy::g2_type::value_type &Q) const {
+                        return std::make_shared<const typename pairing_policy::g2_precomp>(
+                            pairing_policy::precompute_g2(Q));
+                    }
+                };
+
+                /**
+                 * Product of the Miller loops of (P_i, Q_i) for i in [0, size), without final
+                 * exponentiation. The pairs are split into thread_count blocks (0 meaning one per hardware
+                 * thread); each block precomputes its own G1 and G2 elements and runs one multi-Miller loop,
+                 * and the partial products are multiplied together. Pairs with a zero point contribute 1
+                 * and are skipped before precomputation. G2 precomputations are made by precompute_Q, which
+                 * returns a std::shared_ptr<const g2_precomp>, so that cached precomputations are not copied.
+                 */
+                template<typename PairingCurveType, typename InputG1Iterator, typename InputG2Iterator,
+                         typename G2Precompute>
+                typename PairingCurveType::pairing::gt_type::value_type
+                    parallel_miller_loop_product(InputG1Iterator P_first, InputG2Iterator Q_first, std::size_t size,
+                                                 std::size_t thread_count, G2Precompute precompute_Q) {
+                    typedef typename PairingCurveType::pairing pairing_policy;
+                    typedef typename pairing_policy::g1_precomp g1_precomp;
+                    typedef typename pairing_policy::g2_precomp g2_precomp;
+                    typedef typename pairing_policy::gt_type::value_type gt_value_type;
+
+                    gt_value_type result = gt_value_type::one();
+                    std::mutex result_mutex;
+
+                    nil::crypto3::detail::parallel_for(size, thread_count, [&](std::size_t begin, std::size_t end) {
+                        std::vector<g1_precomp> prec_P;
+                        std::vector<std::shared_ptr<const g2_precomp>> prec_Q_owners;
+                        std::vector<const g2_precomp *> prec_Q;
+                        prec_P.reserve(end - begin);
+                        prec_Q_owners.reserve(end - begin);
+                        prec_Q.reserve(end - begin);
+
+                        InputG1Iterator P_it = std::next(P_first, begin);
+                        InputG2Iterator Q_it = std::next(Q_first, begin);
+                        for (std::size_t i = begin; i < end; ++i, ++P_it, ++Q_it) {
+                            if (P_it->is_zero() || Q_it->is_zero()) {
+                                continue;
+                            }
+                            prec_P.emplace_back(pairing_policy::precompute_g1(*P_it));
+                            prec_Q_owners.emplace_back(precompute_Q(*Q_it));
+                            prec_Q.emplace_back(prec_Q_owners.back().get());
+                        }
+
+                        const gt_value_type partial = pairing_policy::multi_miller_loop(prec_P, prec_Q);
+
+                        std::lock_guard<std::mutex> lock(result_mutex);
+                        result = result * partial;
+                    });
+
+                    return result;
+                }
+            }    // namespace detail
+
+            /**
+             * Reduced pairing product prod_i e(P[i], Q[i]) with a single final exponentiation. With
+             * thread_count != 1 the precomputations and Miller loops are spread over several threads.
+             */
+            template<typename PairingCurveType>
+            typename PairingCurveType::pairing::gt_type::value_type
+                pairing_product(const std::vector<typename PairingCurveType::pairing::g1_type::value_type> &P,
+                                const std::vector<typename PairingCurveType::pairing::g2_type::value_type> &Q,
+                                std::size_t thread_count = 1) {
+                BOOST_ASSERT(P.size() == Q.size());
+
+                return PairingCurveType::pairing::final_exponentiation(
+                    detail::parallel_miller_loop_product<PairingCurveType>(
+                        P.cbegin(), Q.cbegin(), P.size(), thread_count,
+                        detail::shared_precompute_g2<PairingCurveType>()));
+            }
+
+            /**
+             * Same as pairing_product, with the G2 precomputations taken from (or added to) cache.
+             */
+            template<typename PairingCurveType>
+            typename PairingCurveType::pairing::gt_type::value_type
+                pairing_product(const std::vector<typename PairingCurveType::pairing::g1_type::value_type> &P,
+                                const std::vector<typename PairingCurveType::pairing::g2_type::value_type> &Q,
+                                pairing::g2_precomp_cache<PairingCurveType> &cache,
+                                std::size_t thread_count = 1) {
+                BOOST_ASSERT(P.size() == Q.size());
+
+                return PairingCurveType::pairing::final_exponentiation(
+                    detail::parallel_miller_loop_product<PairingCurveType>(
+                        P.cbegin(), Q.cbegin(), P.size(), thread_count,
+                        [&cache](const typename PairingCurveType::pairing::g2_type::value_type &Q_i) {
+                            return cache.get(Q_i);
+                        }));
+            }
+
+            /**
+             * Checks prod_i e(P[i], Q[i]) == 1, see pairing_product.
+             */
+            template<typename PairingCurveType>
+            bool pairing_product_is_one(
+                const std::vector<typename PairingCurveType::pairing::g1_type::value_type> &P,
+                const std::vector<typename PairingCurveType::pairing::g2_type::value_type> &Q,
+                std::size_t thread_count = 1) {
+
+                return pairing_product<PairingCurveType>(P, Q, thread_count) ==
+                       PairingCurveType::pairing::gt_type::value_type::one();
+            }
+
+            template<typename PairingCurveType>
+            bool pairing_product_is_one(
+                const std::vector<typename PairingCurveType::pairing::g1_type::value_type> &P,
+                const std::vector<typename PairingCurveType::pairing::g2_type::value_type> &Q,
+                pairing::g2_precomp_cache<PairingCurveType> &cache,
+                std::size_t thread_count = 1) {
+
+                return pairing_product<PairingCurveType>(P, Q, cache, thread_count) ==
+                       PairingCurveType::pairing::gt_type::value_type::one();
+            }
         }    // namespace algebra
     }        // namespace crypto3
 }    // namespace nil
@@ -31,8 +31,8 @@
 #include <nil/crypto3/algebra/curves/detail/alt_bn128/g1.hpp>
 #include <nil/crypto3/algebra/curves/detail/alt_bn128/g2.hpp>
 
-//#include <nil/crypto3/algebra/pairing/alt_bn128.hpp>
-//#include <nil/crypto3/algebra/pairing/detail/alt_bn128/functions.hpp>
+#include <nil/crypto3/algebra/pairing/alt_bn128.hpp>
+#include <nil/crypto3/algebra/pairing/detail/alt_bn128/functions.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -60,8 +60,11 @@ namespace nil {
                     typedef typename detail::alt_bn128_g1<Version> g1_type;
                     typedef typename detail::alt_bn128_g2<Version> g2_type;
 
-                    // typedef typename pairing::pairing_policy<alt_bn128<Version>,
-                    //    pairing::detail::alt_bn128_pairing_functions<Version>> pairing_policy;
+                    constexpr static const bool has_affine_pairing = true;
+
+                    typedef typename pairing::pairing_policy<alt_bn128<Version>,
+                                                             pairing::detail::alt_bn128_pairing_functions<Version>>
+                        pairing;
 
                     typedef typename policy_type::gt_field_type gt_type;
                 };
@@ -64,7 +64,7 @@ namespace nil {
                     typedef typename detail::bls12_g1<Version> g1_type;
                     typedef typename detail::bls12_g2<Version> g2_type;
 
-                    constexpr static const bool has_affine_pairing = false;
+                    constexpr static const bool has_affine_pairing = true;
 
                     typedef typename pairing::pairing_policy<bls12<Version>,
                                                              pairing::detail::bls12_pairing_functions<Version>>
@@ -162,6 +162,33 @@ namespace nil {
                             return (this->is_zero() || this->Z == underlying_field_value_type::one());
                         }
 
+                        /** @brief
+                         *
+                         * @return true if element from group G2 lies on the elliptic curve
+                         */
+                        constexpr bool is_well_formed() const {
+                            if (this->is_zero()) {
+                                return true;
+                            } else {
+                                /*
+                                  y^2 = x^3 + b
+
+                                  We are using Jacobian coordinates, so equation we need to check is actually
+
+                                  y^2 = x^3 + b z^6
+                                */
+                                underlying_field_value_type X2 = this->X.squared();
+                                underlying_field_value_type Y2 = this->Y.squared();
+                                underlying_field_value_type Z2 = this->Z.squared();
+
+                                underlying_field_value_type X3 = this->X * X2;
+                                underlying_field_value_type Z3 = this->Z * Z2;
+                                underlying_field_value_type Z6 = Z3.squared();
+
+                                return (Y2 == X3 + twist_coeff_b * Z6);
+                            }
+                        }
+
                         /*************************  Arithmetic operations  ***********************************/
 
                         constexpr element_alt_bn128_g2 operator=(const element_alt_bn128_g2 &other) {
@@ -320,7 +347,7 @@ namespace nil {
 
                     public:
                         /*************************  Extra arithmetic operations  ***********************************/
-                    private:    // probably shoould be public for pairing
+
                         element_alt_bn128_g2 mul_by_q() const {
                             return element_alt_bn128_g2(twist_mul_by_q_X * (this->X).Frobenius_map(1),
                                                         twist_mul_by_q_Y * (this->Y).Frobenius_map(1),
@@ -334,7 +361,7 @@ namespace nil {
                          *
                          * @return return the corresponding element from group G2 in affine coordinates
                          */
-                        constexpr element_alt_bn128_g2 to_affine() {
+                        constexpr element_alt_bn128_g2 to_affine() const {
                             underlying_field_value_type p_out[3];
 
                             if (this->is_zero()) {
@@ -357,7 +384,7 @@ namespace nil {
                          *
                          * @return return the corresponding element from group G2 in affine coordinates
                          */
-                        constexpr element_alt_bn128_g2 to_projective() {
+                        constexpr element_alt_bn128_g2 to_projective() const {
                             return this->to_affine();
                         }
 
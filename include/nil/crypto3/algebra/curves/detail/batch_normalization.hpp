@@ -0,0 +1,84 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_BATCH_NORMALIZATION_HPP
+#define CRYPTO3_ALGEBRA_CURVES_BATCH_NORMALIZATION_HPP
+
+#include <vector>
+
+#include <nil/crypto3/algebra/fields/detail/batch_inversion.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /**
+                     * Brings non-zero points to the special form (Z = 1) expected by mixed_add, sharing one
+                     * field inversion between all of them.
+                     */
+
+                    // Jacobian coordinates: (X / Z^2, Y / Z^3, 1)
+                    template<typename GroupValueType>
+                    void batch_to_special_jacobian(std::vector<GroupValueType> &vec) {
+                        typedef typename GroupValueType::underlying_field_value_type underlying_field_value_type;
+
+                        std::vector<underlying_field_value_type> z_inv;
+                        z_inv.reserve(vec.size());
+                        for (const GroupValueType &p : vec) {
+                            z_inv.emplace_back(p.Z);
+                        }
+                        fields::detail::batch_inversion(z_inv.begin(), z_inv.end());
+
+                        for (std::size_t i = 0; i < vec.size(); ++i) {
+                            const underlying_field_value_type z2_inv = z_inv[i].squared();
+                            vec[i] = GroupValueType(vec[i].X * z2_inv, vec[i].Y * z2_inv * z_inv[i],
+                                                    underlying_field_value_type::one());
+                        }
+                    }
+
+                    // Homogeneous projective and inverted Edwards coordinates: (X / Z, Y / Z, 1)
+                    template<typename GroupValueType>
+                    void batch_to_special_projective(std::vector<GroupValueType> &vec) {
+                        typedef typename GroupValueType::underlying_field_value_type underlying_field_value_type;
+
+                        std::vector<underlying_field_value_type> z_inv;
+                        z_inv.reserve(vec.size());
+                        for (const GroupValueType &p : vec) {
+                            z_inv.emplace_back(p.Z);
+                        }
+                        fields::detail::batch_inversion(z_inv.begin(), z_inv.end());
+
+                        for (std::size_t i = 0; i < vec.size(); ++i) {
+                            vec[i] = GroupValueType(vec[i].X * z_inv[i], vec[i].Y * z_inv[i],
+                                                    underlying_field_value_type::one());
+                        }
+                    }
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_BATCH_NORMALIZATION_HPP
@@ -27,10 +27,13 @@
 #ifndef CRYPTO3_ALGEBRA_CURVES_BLS12_G1_HPP
 #define CRYPTO3_ALGEBRA_CURVES_BLS12_G1_HPP
 
+#include <vector>
+
 #include <nil/crypto3/algebra/curves/detail/bls12/bls12_377/basic_policy.hpp>
 #include <nil/crypto3/algebra/curves/detail/bls12/bls12_377/element_g1.hpp>
 #include <nil/crypto3/algebra/curves/detail/bls12/bls12_381/basic_policy.hpp>
 #include <nil/crypto3/algebra/curves/detail/bls12/bls12_381/element_g1.hpp>
+#include <nil/crypto3/algebra/curves/detail/batch_normalization.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -59,6 +62,12 @@ namespace nil {
                             underlying_field_type::value_bits + 1;    ///< size of the base field in bits
 
                         using value_type = element_bls12_g1<Version>;
+
+                        /** @brief Brings non-zero elements to the special form used by mixed_add.
+                         */
+                        static void batch_to_special_all_non_zeros(std::vector<value_type> &vec) {
+                            batch_to_special_jacobian(vec);
+                        }
                     };
 
                 }    // namespace detail
@@ -27,11 +27,14 @@
 #ifndef CRYPTO3_ALGEBRA_CURVES_EDWARDS_G1_HPP
 #define CRYPTO3_ALGEBRA_CURVES_EDWARDS_G1_HPP
 
+#include <vector>
+
 #include <nil/crypto3/algebra/curves/detail/edwards/edwards183/basic_policy.hpp>
 #include <nil/crypto3/algebra/curves/detail/edwards/edwards183/element_g1.hpp>
 #include <nil/crypto3/algebra/curves/detail/edwards/jubjub/basic_policy.hpp>
 #include <nil/crypto3/algebra/curves/detail/edwards/babyjubjub/basic_policy.hpp>
 #include <nil/crypto3/algebra/curves/detail/edwards/babyjubjub/element_g1.hpp>
+#include <nil/crypto3/algebra/curves/detail/batch_normalization.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -67,6 +70,12 @@ namespace nil {
                             underlying_field_type::value_bits + 1;    ///< size of the base field in bits
 
                         using value_type = element_edwards_g1<version>;
+
+                        /** @brief Brings non-zero elements to the special form used by mixed_add.
+                         */
+                        static void batch_to_special_all_non_zeros(std::vector<value_type> &vec) {
+                            batch_to_special_projective(vec);
+                        }
                     };
 
                     // JubJub
@@ -27,8 +27,11 @@
 #ifndef CRYPTO3_ALGEBRA_CURVES_MNT6_G2_HPP
 #define CRYPTO3_ALGEBRA_CURVES_MNT6_G2_HPP
 
+#include <vector>
+
 #include <nil/crypto3/algebra/curves/detail/mnt6/basic_policy.hpp>
 #include <nil/crypto3/algebra/curves/detail/mnt6/element_g2.hpp>
+#include <nil/crypto3/algebra/curves/detail/batch_normalization.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -56,6 +59,12 @@ namespace nil {
                             underlying_field_type::value_bits + 1;    ///< size of the base field in bits
 
                         using value_type = element_mnt6_g2<Version>;
+
+                        /** @brief Brings non-zero elements to the special form used by mixed_add.
+                         */
+                        static void batch_to_special_all_non_zeros(std::vector<value_type> &vec) {
+                            batch_to_special_projective(vec);
+                        }
                     };
 
                 }    // namespace detail
@@ -37,6 +37,9 @@ namespace nil {
                 template<typename GroupType>
                 struct wnaf_params;
 
+                template<typename GroupType>
+                struct glv_params;
+
             }    // namespace curves
         }        // namespace algebra
     }            // namespace crypto3
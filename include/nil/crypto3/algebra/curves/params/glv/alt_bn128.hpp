@@ -0,0 +1,95 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_ALT_BN128_GLV_PARAMS_HPP
+#define CRYPTO3_ALGEBRA_CURVES_ALT_BN128_GLV_PARAMS_HPP
+
+#include <nil/crypto3/algebra/curves/params.hpp>
+
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+
+                template<typename GroupType>
+                struct glv_params;
+
+                /************************* ALT_BN128-254 ***********************************/
+
+                /**
+                 * GLV parameters of the G1 endomorphism phi(x, y) = (beta * x, y), phi(P) = lambda * P.
+                 * (a1, -minus_b1) and (a2, b2) are a reduced basis of the lattice {(x, y) : x + y * lambda = 0 mod r}
+                 * with a1 * b2 + a2 * minus_b1 = r. The rounding constants are
+                 * round(2^rounding_shift * b2 / r) and round(2^rounding_shift * minus_b1 / r), and both halves of
+                 * a decomposed scalar are at most decomposition_bits long.
+                 */
+                template<>
+                struct glv_params<typename alt_bn128<254>::g1_type> {
+                    typedef typename alt_bn128<254>::g1_type::underlying_field_type::value_type underlying_field_value_type;
+                    typedef typename alt_bn128<254>::scalar_field_type::modulus_type modulus_type;
+
+                    constexpr static const std::size_t decomposition_bits = 128;
+                    constexpr static const std::size_t rounding_shift = 256;
+
+                    constexpr static const underlying_field_value_type beta =
+                        underlying_field_value_type(0x59E26BCEA0D48BACD4F263F1ACDB5C4F5763473177FFFFFE_cppui191);
+                    constexpr static const modulus_type lambda = 0xB3C4D79D41A917585BFC41088D8DAAA78B17EA66B99C90DD_cppui192;
+
+                    constexpr static const modulus_type a1 = 0x89D3256894D213E3_cppui64;
+                    constexpr static const modulus_type minus_b1 = 0x6F4D8248EEB859FC8211BBEB7D4F1128_cppui127;
+                    constexpr static const modulus_type a2 = 0x6F4D8248EEB859FD0BE4E1541221250B_cppui127;
+                    constexpr static const modulus_type b2 = 0x89D3256894D213E3_cppui64;
+
+                    constexpr static const modulus_type b2_over_r = 0x2D91D232EC7E0B3D7_cppui66;
+                    constexpr static const modulus_type minus_b1_over_r = 0x24CCEF014A773D2CF7A7BD9D4391EB18E_cppui130;
+                };
+
+                /************************* ALT_BN128-254 definitions ***********************************/
+
+                constexpr typename glv_params<typename alt_bn128<254>::g1_type>::underlying_field_value_type const
+                    glv_params<typename alt_bn128<254>::g1_type>::beta;
+                constexpr typename glv_params<typename alt_bn128<254>::g1_type>::modulus_type const
+                    glv_params<typename alt_bn128<254>::g1_type>::lambda;
+                constexpr typename glv_params<typename alt_bn128<254>::g1_type>::modulus_type const
+                    glv_params<typename alt_bn128<254>::g1_type>::a1;
+                constexpr typename glv_params<typename alt_bn128<254>::g1_type>::modulus_type const
+                    glv_params<typename alt_bn128<254>::g1_type>::minus_b1;
+                constexpr typename glv_params<typename alt_bn128<254>::g1_type>::modulus_type const
+                    glv_params<typename alt_bn128<254>::g1_type>::a2;
+                constexpr typename glv_params<typename alt_bn128<254>::g1_type>::modulus_type const
+                    glv_params<typename alt_bn128<254>::g1_type>::b2;
+                constexpr typename glv_params<typename alt_bn128<254>::g1_type>::modulus_type const
+                    glv_params<typename alt_bn128<254>::g1_type>::b2_over_r;
+                constexpr typename glv_params<typename alt_bn128<254>::g1_type>::modulus_type const
+                    glv_params<typename alt_bn128<254>::g1_type>::minus_b1_over_r;
+
+            }    // namespace curves
+        }        // namespace algebra
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_ALT_BN128_GLV_PARAMS_HPP
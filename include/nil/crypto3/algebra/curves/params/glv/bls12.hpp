@@ -0,0 +1,137 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_BLS12_GLV_PARAMS_HPP
+#define CRYPTO3_ALGEBRA_CURVES_BLS12_GLV_PARAMS_HPP
+
+#include <nil/crypto3/algebra/curves/params.hpp>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+
+                template<typename GroupType>
+                struct glv_params;
+
+                /************************* BLS12-381 ***********************************/
+
+                /**
+                 * GLV parameters of the G1 endomorphism phi(x, y) = (beta * x, y), phi(P) = lambda * P.
+                 * (a1, -minus_b1) and (a2, b2) are a reduced basis of the lattice {(x, y) : x + y * lambda = 0 mod r}
+                 * with a1 * b2 + a2 * minus_b1 = r. The rounding constants are
+                 * round(2^rounding_shift * b2 / r) and round(2^rounding_shift * minus_b1 / r), and both halves of
+                 * a decomposed scalar are at most decomposition_bits long.
+                 */
+                template<>
+                struct glv_params<typename bls12<381>::g1_type> {
+                    typedef typename bls12<381>::g1_type::underlying_field_type::value_type underlying_field_value_type;
+                    typedef typename bls12<381>::scalar_field_type::modulus_type modulus_type;
+
+                    constexpr static const std::size_t decomposition_bits = 128;
+                    constexpr static const std::size_t rounding_shift = 257;
+
+                    constexpr static const underlying_field_value_type beta =
+                        underlying_field_value_type(0x1A0111EA397FE699EC02408663D4DE85AA0D857D89759AD4897D29650FB85F9B409427EB4F49FFFD8BFD00000000AAAC_cppui381);
+                    constexpr static const modulus_type lambda = 0xAC45A4010001A40200000000FFFFFFFF_cppui128;
+
+                    constexpr static const modulus_type a1 = 0xAC45A4010001A40200000000FFFFFFFF_cppui128;
+                    constexpr static const modulus_type minus_b1 = modulus_type(0x01);
+                    constexpr static const modulus_type a2 = modulus_type(0x01);
+                    constexpr static const modulus_type b2 = 0xAC45A4010001A4020000000100000000_cppui128;
+
+                    constexpr static const modulus_type b2_over_r = 0x2F8D7D9E3C03F55BAC7EDCA45ED9FDC60_cppui130;
+                    constexpr static const modulus_type minus_b1_over_r = modulus_type(0x04);
+                };
+
+                /************************* BLS12-377 ***********************************/
+
+                template<>
+                struct glv_params<typename bls12<377>::g1_type> {
+                    typedef typename bls12<377>::g1_type::underlying_field_type::value_type underlying_field_value_type;
+                    typedef typename bls12<377>::scalar_field_type::modulus_type modulus_type;
+
+                    constexpr static const std::size_t decomposition_bits = 128;
+                    constexpr static const std::size_t rounding_shift = 255;
+
+                    constexpr static const underlying_field_value_type beta =
+                        underlying_field_value_type(0x9B3AF05DD14F6EC619AAF7D34594AABC5ED1347970DEC00452217CC900000008508C00000000001_cppui316);
+                    constexpr static const modulus_type lambda = 0x452217CC900000010A11800000000000_cppui127;
+
+                    constexpr static const modulus_type a1 = 0x452217CC900000010A11800000000000_cppui127;
+                    constexpr static const modulus_type minus_b1 = modulus_type(0x01);
+                    constexpr static const modulus_type a2 = modulus_type(0x01);
+                    constexpr static const modulus_type b2 = 0x452217CC900000010A11800000000001_cppui127;
+
+                    constexpr static const modulus_type b2_over_r = 0x1D9FBD54B4FE9B8B03FB9769957C80C16_cppui129;
+                    constexpr static const modulus_type minus_b1_over_r = modulus_type(0x07);
+                };
+
+                /************************* BLS12-381 definitions ***********************************/
+
+                constexpr typename glv_params<typename bls12<381>::g1_type>::underlying_field_value_type const
+                    glv_params<typename bls12<381>::g1_type>::beta;
+                constexpr typename glv_params<typename bls12<381>::g1_type>::modulus_type const
+                    glv_params<typename bls12<381>::g1_type>::lambda;
+                constexpr typename glv_params<typename bls12<381>::g1_type>::modulus_type const
+                    glv_params<typename bls12<381>::g1_type>::a1;
+                constexpr typename glv_params<typename bls12<381>::g1_type>::modulus_type const
+                    glv_params<typename bls12<381>::g1_type>::minus_b1;
+                constexpr typename glv_params<typename bls12<381>::g1_type>::modulus_type const
+                    glv_params<typename bls12<381>::g1_type>::a2;
+                constexpr typename glv_params<typename bls12<381>::g1_type>::modulus_type const
+                    glv_params<typename bls12<381>::g1_type>::b2;
+                constexpr typename glv_params<typename bls12<381>::g1_type>::modulus_type const
+                    glv_params<typename bls12<381>::g1_type>::b2_over_r;
+                constexpr typename glv_params<typename bls12<381>::g1_type>::modulus_type const
+                    glv_params<typename bls12<381>::g1_type>::minus_b1_over_r;
+
+                /************************* BLS12-377 definitions ***********************************/
+
+                constexpr typename glv_params<typename bls12<377>::g1_type>::underlying_field_value_type const
+                    glv_params<typename bls12<377>::g1_type>::beta;
+                constexpr typename glv_params<typename bls12<377>::g1_type>::modulus_type const
+                    glv_params<typename bls12<377>::g1_type>::lambda;
+                constexpr typename glv_params<typename bls12<377>::g1_type>::modulus_type const
+                    glv_params<typename bls12<377>::g1_type>::a1;
+                constexpr typename glv_params<typename bls12<377>::g1_type>::modulus_type const
+                    glv_params<typename bls12<377>::g1_type>::minus_b1;
+                constexpr typename glv_params<typename bls12<377>::g1_type>::modulus_type const
+                    glv_params<typename bls12<377>::g1_type>::a2;
+                constexpr typename glv_params<typename bls12<377>::g1_type>::modulus_type const
+                    glv_params<typename bls12<377>::g1_type>::b2;
+                constexpr typename glv_params<typename bls12<377>::g1_type>::modulus_type const
+                    glv_params<typename bls12<377>::g1_type>::b2_over_r;
+                constexpr typename glv_params<typename bls12<377>::g1_type>::modulus_type const
+                    glv_params<typename bls12<377>::g1_type>::minus_b1_over_r;
+
+            }    // namespace curves
+        }        // namespace algebra
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_BLS12_GLV_PARAMS_HPP
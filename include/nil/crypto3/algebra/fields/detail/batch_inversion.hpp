@@ -0,0 +1,76 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_FIELDS_BATCH_INVERSION_HPP
+#define CRYPTO3_ALGEBRA_FIELDS_BATCH_INVERSION_HPP
+
+#include <iterator>
+#include <vector>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace fields {
+                namespace detail {
+                    /**
+                     * Inverts all elements of the range in place with a single field inversion
+                     * (Montgomery's trick), at the price of 3(n - 1) multiplications.
+                     * All elements are required to be non-zero.
+                     */
+                    template<typename FieldValueIterator>
+                    void batch_inversion(FieldValueIterator first, FieldValueIterator last) {
+                        typedef typename std::iterator_traits<FieldValueIterator>::value_type field_value_type;
+
+                        if (first == last) {
+                            return;
+                        }
+
+                        // prefix[i] = a_0 * ... * a_{i - 1}
+                        std::vector<field_value_type> prefix;
+                        prefix.reserve(std::distance(first, last));
+
+                        field_value_type acc = field_value_type::one();
+                        for (FieldValueIterator it = first; it != last; ++it) {
+                            prefix.emplace_back(acc);
+                            acc = acc * (*it);
+                        }
+
+                        // acc = (a_0 * ... * a_{n - 1})^{-1}
+                        acc = acc.inversed();
+
+                        FieldValueIterator it = last;
+                        for (std::size_t i = prefix.size(); i-- > 0;) {
+                            --it;
+                            const field_value_type inverse = acc * prefix[i];
+                            acc = acc * (*it);
+                            *it = inverse;
+                        }
+                    }
+                }    // namespace detail
+            }        // namespace fields
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_FIELDS_BATCH_INVERSION_HPP
@@ -245,25 +245,7 @@ namespace nil {
 
                         template<typename PowerType>
                         element_fp12_2over3over2 cyclotomic_exp(const PowerType &exponent) const {
-                            element_fp12_2over3over2 res = one();
-
-                            if (exponent == 0)
-                                return res;
-
-                            bool found_one = false;
-                            for (long i = nil::crypto3::multiprecision::msb(exponent); i >= 0; --i) {
-                                if (found_one) {
-                                    res = res.cyclotomic_squared();
-                                }
-
-                                if (nil::crypto3::multiprecision::bit_test(exponent, i)) {
-                                    found_one = true;
-                                    res = res * (*this);
-                                }
-                            }
-
-                            return res;
-                            // return *this;
+                            return cyclotomic_power(*this, exponent);
                         }
 
                         element_fp12_2over3over2
@@ -318,6 +300,132 @@ namespace nil {
                             return (*this) * a;
                         }
 
+                        /**
+                         * Multiplication by a line normalized so that its coefficient at position 0 lies in
+                         * the base field, which turns six of the Fp2 products into Fp by Fp2 ones.
+                         */
+                        element_fp12_2over3over2
+                            mul_by_045(const typename underlying_type::underlying_type &ell_0,
+                                       const typename underlying_type::underlying_type::underlying_type &ell_VW,
+                                       const typename underlying_type::underlying_type &ell_VV) const {
+
+                            const typename underlying_type::underlying_type &z0 = this->data[0].data[0];
+                            const typename underlying_type::underlying_type &z1 = this->data[0].data[1];
+                            const typename underlying_type::underlying_type &z2 = this->data[0].data[2];
+                            const typename underlying_type::underlying_type &z3 = this->data[1].data[0];
+                            const typename underlying_type::underlying_type &z4 = this->data[1].data[1];
+                            const typename underlying_type::underlying_type &z5 = this->data[1].data[2];
+
+                            const typename underlying_type::underlying_type::underlying_type &x0 = ell_VW;
+                            const typename underlying_type::underlying_type &x4 = ell_0;
+                            const typename underlying_type::underlying_type &x5 = ell_VV;
+
+                            const typename underlying_type::underlying_type nr = element_fp12_2over3over2().non_residue;
+
+                            const typename underlying_type::underlying_type t0 = x0 * z0 + nr * (x4 * z4 + x5 * z3);
+                            const typename underlying_type::underlying_type t1 = x0 * z1 + nr * (x4 * z5 + x5 * z4);
+                            const typename underlying_type::underlying_type t2 = x0 * z2 + x4 * z3 + nr * (x5 * z5);
+                            const typename underlying_type::underlying_type t3 = x0 * z3 + nr * (x4 * z2 + x5 * z1);
+                            const typename underlying_type::underlying_type t4 = x0 * z4 + x4 * z0 + nr * (x5 * z2);
+                            const typename underlying_type::underlying_type t5 = x0 * z5 + x4 * z1 + x5 * z0;
+
+                            return element_fp12_2over3over2(underlying_type(t0, t1, t2), underlying_type(t3, t4, t5));
+                        }
+
+                        /**
+                         * Multiplication by a line normalized so that its coefficient at position 4 lies in
+                         * the base field, expanded instead of going through a full Fp12 multiplication.
+                         */
+                        element_fp12_2over3over2
+                            mul_by_024(const typename underlying_type::underlying_type &ell_0,
+                                       const typename underlying_type::underlying_type::underlying_type &ell_VW,
+                                       const typename underlying_type::underlying_type &ell_VV) const {
+
+                            const typename underlying_type::underlying_type &z0 = this->data[0].data[0];
+                            const typename underlying_type::underlying_type &z1 = this->data[0].data[1];
+                            const typename underlying_type::underlying_type &z2 = this->data[0].data[2];
+                            const typename underlying_type::underlying_type &z3 = this->data[1].data[0];
+                            const typename underlying_type::underlying_type &z4 = this->data[1].data[1];
+                            const typename underlying_type::underlying_type &z5 = this->data[1].data[2];
+
+                            const typename underlying_type::underlying_type &x0 = ell_0;
+                            const typename underlying_type::underlying_type &x2 = ell_VV;
+                            const typename underlying_type::underlying_type::underlying_type &x4 = ell_VW;
+
+                            const typename underlying_type::underlying_type nr = element_fp12_2over3over2().non_residue;
+
+                            const typename underlying_type::underlying_type t0 = x0 * z0 + nr * (x2 * z1 + x4 * z4);
+                            const typename underlying_type::underlying_type t1 = x0 * z1 + nr * (x2 * z2 + x4 * z5);
+                            const typename underlying_type::underlying_type t2 = x0 * z2 + x2 * z0 + x4 * z3;
+                            const typename underlying_type::underlying_type t3 = x0 * z3 + nr * (x2 * z4 + x4 * z2);
+                            const typename underlying_type::underlying_type t4 = x0 * z4 + x4 * z0 + nr * (x2 * z5);
+                            const typename underlying_type::underlying_type t5 = x0 * z5 + x2 * z3 + x4 * z1;
+
+                            return element_fp12_2over3over2(underlying_type(t0, t1, t2), underlying_type(t3, t4, t5));
+                        }
+
+                        /**
+                         * Product of two lines in the layout of mul_by_045, i.e. with non-zero coefficients at
+                         * positions 0, 4 and 5 only. Karatsuba over the three coefficients takes 6 Fp2
+                         * multiplications, and the result is zero at position 3.
+                         */
+                        static element_fp12_2over3over2
+                            mul_045_by_045(const typename underlying_type::underlying_type &ell_0_a,
+                                           const typename underlying_type::underlying_type &ell_VW_a,
+                                           const typename underlying_type::underlying_type &ell_VV_a,
+                                           const typename underlying_type::underlying_type &ell_0_b,
+                                           const typename underlying_type::underlying_type &ell_VW_b,
+                                           const typename underlying_type::underlying_type &ell_VV_b) {
+
+                            const typename underlying_type::underlying_type nr = element_fp12_2over3over2().non_residue;
+
+                            const typename underlying_type::underlying_type x0y0 = ell_VW_a * ell_VW_b;
+                            const typename underlying_type::underlying_type x4y4 = ell_0_a * ell_0_b;
+                            const typename underlying_type::underlying_type x5y5 = ell_VV_a * ell_VV_b;
+
+                            const typename underlying_type::underlying_type x0y4_x4y0 =
+                                (ell_VW_a + ell_0_a) * (ell_VW_b + ell_0_b) - x0y0 - x4y4;
+                            const typename underlying_type::underlying_type x0y5_x5y0 =
+                                (ell_VW_a + ell_VV_a) * (ell_VW_b + ell_VV_b) - x0y0 - x5y5;
+                            const typename underlying_type::underlying_type x4y5_x5y4 =
+                                (ell_0_a + ell_VV_a) * (ell_0_b + ell_VV_b) - x4y4 - x5y5;
+
+                            return element_fp12_2over3over2(
+                                underlying_type(x0y0 + nr * x4y4, nr * x4y5_x5y4, nr * x5y5),
+                                underlying_type(underlying_type::underlying_type::zero(), x0y4_x4y0, x0y5_x5y0));
+                        }
+
+                        /**
+                         * Product of two lines in the layout of mul_by_024, with non-zero coefficients at positions
+                         * 0, 2 and 4 only. Same 6 Fp2 multiplications as mul_045_by_045; the result is zero at
+                         * position 5.
+                         */
+                        static element_fp12_2over3over2
+                            mul_024_by_024(const typename underlying_type::underlying_type &ell_0_a,
+                                           const typename underlying_type::underlying_type &ell_VW_a,
+                                           const typename underlying_type::underlying_type &ell_VV_a,
+                                           const typename underlying_type::underlying_type &ell_0_b,
+                                           const typename underlying_type::underlying_type &ell_VW_b,
+                                           const typename underlying_type::underlying_type &ell_VV_b) {
+
+                            const typename underlying_type::underlying_type nr = element_fp12_2over3over2().non_residue;
+
+                            const typename underlying_type::underlying_type x0y0 = ell_0_a * ell_0_b;
+                            const typename underlying_type::underlying_type x2y2 = ell_VV_a * ell_VV_b;
+                            const typename underlying_type::underlying_type x4y4 = ell_VW_a * ell_VW_b;
+
+                            const typename underlying_type::underlying_type x0y2_x2y0 =
+                                (ell_0_a + ell_VV_a) * (ell_0_b + ell_VV_b) - x0y0 - x2y2;
+                            const typename underlying_type::underlying_type x0y4_x4y0 =
+                                (ell_0_a + ell_VW_a) * (ell_0_b + ell_VW_b) - x0y0 - x4y4;
+                            const typename underlying_type::underlying_type x2y4_x4y2 =
+                                (ell_VV_a + ell_VW_a) * (ell_VV_b + ell_VW_b) - x2y2 - x4y4;
+
+                            return element_fp12_2over3over2(
+                                underlying_type(x0y0 + nr * x4y4, nr * x2y2, x0y2_x2y0),
+                                underlying_type(nr * x2y4_x4y2, x0y4_x4y0, underlying_type::underlying_type::zero()));
+                        }
+
                         /*element_fp12_2over3over2 sqru() {
                             element_fp2<FieldParams> &z0(a_.a_);
                             element_fp2<FieldParams> &z4(a_.b_);
@@ -0,0 +1,161 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_FIELDS_ELEMENT_FP12_2OVER3OVER2_T2_HPP
+#define CRYPTO3_ALGEBRA_FIELDS_ELEMENT_FP12_2OVER3OVER2_T2_HPP
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/algebra/fields/detail/element/fp12_2over3over2.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace fields {
+                namespace detail {
+
+                    /**
+                     * Element of the cyclotomic subgroup of Fp12 = Fp6[w]/(w^2 - v) kept in the algebraic torus T2
+                     * representation, i.e. as the single Fp6 coordinate m with f = (m + w) / (m - w).
+                     *
+                     * Every f = c0 + c1 * w of norm c0^2 - v * c1^2 = 1 other than +-1 has exactly one such m, namely
+                     * m = (1 + c0) / c1, which halves the size of the element. The identity is stored as m = 0,
+                     * which would otherwise stand for -1; -1 is never an element of a prime order GT, so the
+                     * representation is lossless there. Elements outside the cyclotomic subgroup, e.g. unreduced
+                     * Miller loop outputs, cannot be compressed.
+                     *
+                     * From Rubin and Silverberg, "Compression in finite fields and torus-based cryptography".
+                     */
+                    template<typename FieldParams>
+                    class element_fp12_2over3over2_t2 {
+                    public:
+                        typedef element_fp12_2over3over2<FieldParams> extension_type;
+                        typedef typename extension_type::underlying_type underlying_type;
+
+                        underlying_type data;
+
+                        element_fp12_2over3over2_t2() : data(underlying_type::zero()) {
+                        }
+
+                        explicit element_fp12_2over3over2_t2(const underlying_type &in_data) : data(in_data) {
+                        }
+
+                        inline static element_fp12_2over3over2_t2 one() {
+                            return element_fp12_2over3over2_t2();
+                        }
+
+                        bool is_one() const {
+                            return data == underlying_type::zero();
+                        }
+
+                        bool operator==(const element_fp12_2over3over2_t2 &B) const {
+                            return data == B.data;
+                        }
+
+                        bool operator!=(const element_fp12_2over3over2_t2 &B) const {
+                            return data != B.data;
+                        }
+
+                        /**
+                         * Compresses an element of the cyclotomic subgroup with one Fp6 inversion.
+                         */
+                        static element_fp12_2over3over2_t2 compress(const extension_type &elt) {
+                            if (elt.data[1] == underlying_type::zero()) {
+                                BOOST_ASSERT(elt == extension_type::one());
+                                return one();
+                            }
+
+                            return element_fp12_2over3over2_t2((underlying_type::one() + elt.data[0]) *
+                                                               elt.data[1].inversed());
+                        }
+
+                        /**
+                         * Recovers f = (m^2 + v + 2m * w) / (m^2 - v) with one Fp6 inversion; m^2 - v never
+                         * vanishes since v is not a square in Fp6.
+                         */
+                        extension_type decompress() const {
+                            if (is_one()) {
+                                return extension_type::one();
+                            }
+
+                            const underlying_type m2 = data.squared();
+                            // m^2 - v = -((-m^2) + v)
+                            const underlying_type denominator_inv = (-add_to_non_residue(-m2)).inversed();
+
+                            return extension_type(add_to_non_residue(m2) * denominator_inv,
+                                                  data.doubled() * denominator_inv);
+                        }
+
+                        /**
+                         * Product in compressed form, m3 = (m1 * m2 + v) / (m1 + m2): one Fp6 multiplication and
+                         * one Fp6 inversion, against three inversions for decompressing both operands and
+                         * compressing the Fp12 product.
+                         */
+                        element_fp12_2over3over2_t2 operator*(const element_fp12_2over3over2_t2 &B) const {
+                            if (is_one()) {
+                                return B;
+                            }
+                            if (B.is_one()) {
+                                return *this;
+                            }
+
+                            const underlying_type sum = data + B.data;
+                            if (sum == underlying_type::zero()) {
+                                return one();
+                            }
+
+                            return element_fp12_2over3over2_t2(add_to_non_residue(data * B.data) * sum.inversed());
+                        }
+
+                        element_fp12_2over3over2_t2 &operator*=(const element_fp12_2over3over2_t2 &B) {
+                            *this = *this * B;
+
+                            return *this;
+                        }
+
+                        /**
+                         * The inverse of a unitary element is its conjugate (m - w) / (m + w), i.e. -m.
+                         */
+                        element_fp12_2over3over2_t2 inversed() const {
+                            return element_fp12_2over3over2_t2(-data);
+                        }
+
+                    private:
+                        /**
+                         * A + v, where v = (0, 1, 0) is the non-residue defining Fp12 over Fp6.
+                         */
+                        static underlying_type add_to_non_residue(const underlying_type &A) {
+                            return underlying_type(A.data[0], A.data[1] + underlying_type::underlying_type::one(),
+                                                   A.data[2]);
+                        }
+                    };
+
+                }    // namespace detail
+            }        // namespace fields
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_FIELDS_ELEMENT_FP12_2OVER3OVER2_T2_HPP
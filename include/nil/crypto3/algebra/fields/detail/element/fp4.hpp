@@ -184,31 +184,7 @@ namespace nil {
 
                         template<typename PowerType>
                         element_fp4 cyclotomic_exp(const PowerType &exponent) const {
-                            element_fp4 res = this->one();
-                            element_fp4 this_inverse = this->unitary_inversed();
-
-                            bool found_nonzero = false;
-                            std::vector<long> NAF = nil::crypto3::multiprecision::find_wnaf(1, exponent);
-
-                            for (long i = static_cast<long>(NAF.size() - 1); i >= 0; --i) {
-                                if (found_nonzero) {
-                                    res = res.cyclotomic_squared();
-                                }
-
-                                if (NAF[i] != 0) {
-                                    found_nonzero = true;
-
-                                    if (NAF[i] > 0) {
-                                        res = res * (*this);
-                                    } else {
-                                        res = res * this_inverse;
-                                    }
-                                }
-                            }
-
-                            return res;
-
-                            // return *this;
+                            return cyclotomic_power(*this, exponent);
                         }
 
                         constexpr /*inline static*/ underlying_type mul_by_non_residue(const underlying_type &A) const {
@@ -27,10 +27,14 @@
 #ifndef CRYPTO3_ALGEBRA_FIELDS_POWER_HPP
 #define CRYPTO3_ALGEBRA_FIELDS_POWER_HPP
 
+#include <algorithm>
 #include <cstdint>
+#include <cstdlib>
+#include <vector>
 
 #include <nil/crypto3/multiprecision/number.hpp>
 #include <nil/crypto3/multiprecision/cpp_int.hpp>
+#include <nil/crypto3/multiprecision/wnaf.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -59,6 +63,151 @@ namespace nil {
 
                         return result;
                     }
+
+                    /**
+                     * Odd powers base, base^3, ..., base^(2^window - 1) indexed by the digits of
+                     * multiprecision::find_wnaf(window, .), for base in a cyclotomic subgroup.
+                     */
+                    template<typename FieldValueType>
+                    std::vector<FieldValueType> cyclotomic_wnaf_table(const FieldValueType &base, std::size_t window) {
+                        std::vector<FieldValueType> table(std::size_t(1) << (window - 1));
+                        table[0] = base;
+                        if (table.size() > 1) {
+                            const FieldValueType base_squared = base.cyclotomic_squared();
+                            for (std::size_t i = 1; i < table.size(); ++i) {
+                                table[i] = table[i - 1] * base_squared;
+                            }
+                        }
+
+                        return table;
+                    }
+
+                    /**
+                     * Window for the joint wNAF evaluation of [first, last) minimizing the number of multiplications,
+                     * i.e. the table products of every exponent plus its non-zero digits; the squarings do not
+                     * depend on the window. Sparse exponents such as the curve parameters of pairing-friendly
+                     * curves end up with window 1, the plain NAF.
+                     */
+                    template<typename InputNumberIterator>
+                    std::size_t cyclotomic_wnaf_window(InputNumberIterator first, InputNumberIterator last) {
+                        constexpr std::size_t max_window = 5;
+
+                        std::size_t best = 1;
+                        std::size_t best_cost = std::size_t(-1);
+                        for (std::size_t window = 1; window <= max_window; ++window) {
+                            std::size_t cost = 0;
+                            for (InputNumberIterator it = first; it != last; ++it) {
+                                cost += window > 1 ? std::size_t(1) << (window - 1) : 0;
+                                for (long digit : nil::crypto3::multiprecision::find_wnaf(window, *it)) {
+                                    cost += digit != 0;
+                                }
+                            }
+                            if (cost < best_cost) {
+                                best = window;
+                                best_cost = cost;
+                            }
+                        }
+
+                        return best;
+                    }
+
+                    /**
+                     * prod_j base_j^(e_j) from the wNAF digits naf_j of e_j and the tables of odd powers of base_j
+                     * (see cyclotomic_wnaf_table), sharing one chain of cyclotomic squarings between all j.
+                     * Negative digits use the unitary inverse, which is free in a cyclotomic subgroup.
+                     */
+                    template<typename FieldValueType>
+                    FieldValueType cyclotomic_wnaf_product(const std::vector<std::vector<FieldValueType>> &tables,
+                                                           const std::vector<std::vector<long>> &nafs) {
+                        std::size_t length = 0;
+                        for (const std::vector<long> &naf : nafs) {
+                            length = std::max(length, naf.size());
+                        }
+
+                        FieldValueType result = FieldValueType::one();
+                        bool found_nonzero = false;
+                        for (std::size_t i = length; i-- > 0;) {
+                            if (found_nonzero) {
+                                result = result.cyclotomic_squared();
+                            }
+
+                            for (std::size_t j = 0; j < nafs.size(); ++j) {
+                                const long digit = i < nafs[j].size() ? nafs[j][i] : 0;
+                                if (digit == 0) {
+                                    continue;
+                                }
+
+                                const FieldValueType factor =
+                                    digit > 0 ? tables[j][digit / 2] : tables[j][(-digit) / 2].unitary_inversed();
+                                result = found_nonzero ? result * factor : factor;
+                                found_nonzero = true;
+                            }
+                        }
+
+                        return result;
+                    }
+
+                    /**
+                     * Signed wNAF recoding of an exponent with the window chosen by cyclotomic_wnaf_window. Fixed
+                     * exponents, such as the curve parameters used by the final exponentiations, are recoded once
+                     * and kept, e.g. in a function-local static.
+                     */
+                    struct cyclotomic_wnaf_exponent {
+                        template<typename NumberType>
+                        explicit cyclotomic_wnaf_exponent(const NumberType &exponent) :
+                            window(cyclotomic_wnaf_window(&exponent, &exponent + 1)),
+                            naf(nil::crypto3::multiprecision::find_wnaf(window, exponent)) {
+                        }
+
+                        std::size_t window;
+                        std::vector<long> naf;
+                    };
+
+                    /**
+                     * base^exponent for base in a cyclotomic subgroup from a recoded exponent. Window 1, the plain
+                     * NAF of sparse exponents, needs no table of odd powers.
+                     */
+                    template<typename FieldValueType>
+                    FieldValueType cyclotomic_power(const FieldValueType &base,
+                                                    const cyclotomic_wnaf_exponent &exponent) {
+                        std::vector<FieldValueType> table;
+                        if (exponent.window > 1) {
+                            table = cyclotomic_wnaf_table(base, exponent.window);
+                        }
+
+                        FieldValueType result = FieldValueType::one();
+                        bool found_nonzero = false;
+                        for (std::size_t i = exponent.naf.size(); i-- > 0;) {
+                            if (found_nonzero) {
+                                result = result.cyclotomic_squared();
+                            }
+
+                            const long digit = exponent.naf[i];
+                            if (digit == 0) {
+                                continue;
+                            }
+
+                            const FieldValueType &odd_power = table.empty() ? base : table[std::labs(digit) / 2];
+                            const FieldValueType factor = digit > 0 ? odd_power : odd_power.unitary_inversed();
+                            result = found_nonzero ? result * factor : factor;
+                            found_nonzero = true;
+                        }
+
+                        return result;
+                    }
+
+                    /**
+                     * base^exponent for base in a cyclotomic subgroup with signed wNAF, the window being chosen by
+                     * cyclotomic_wnaf_window.
+                     */
+                    template<typename FieldValueType, typename NumberType>
+                    FieldValueType cyclotomic_power(const FieldValueType &base, const NumberType &exponent) {
+                        if (exponent == 0) {
+                            return FieldValueType::one();
+                        }
+
+                        return cyclotomic_power(base, cyclotomic_wnaf_exponent(exponent));
+                    }
                 }    // namespace detail
             }        // namespace fields
         }            // namespace algebra
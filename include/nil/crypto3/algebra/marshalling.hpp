@@ -34,6 +34,7 @@
 #include <nil/crypto3/detail/stream_endian.hpp>
 
 #include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/fields/detail/element/fp12_2over3over2_t2.hpp>
 
 #include <nil/crypto3/algebra/curves/detail/marshalling.hpp>
 
@@ -154,6 +155,10 @@ namespace nil {
             constexpr static std::size_t g1_octets_num = fp_octets_num;
             constexpr static std::size_t g2_octets_num = 2 * fp_octets_num;
             constexpr static std::size_t gt_octets_num = gt_type::arity * fp_octets_num;
+            constexpr static std::size_t gt_compressed_octets_num = gt_octets_num / 2;
+
+            typedef crypto3::algebra::fields::detail::element_fp12_2over3over2_t2<typename gt_type::extension_policy>
+                gt_compressed_value_type;
 
             // template<typename FieldType>
             // constexpr static inline std::size_t get_field_element_size() {
@@ -266,6 +271,54 @@ namespace nil {
                 return field_bincode<FieldType>::field_element_to_bytes(element, out_first, out_last);
             }
 
+            template<typename OutputIterator>
+            static inline typename std::enable_if<
+                std::is_same<chunk_type, typename std::iterator_traits<OutputIterator>::value_type>::value,
+                std::size_t>::type
+                gt_compressed_to_bytes(const gt_compressed_value_type &element, OutputIterator out_first,
+                                       OutputIterator out_last) {
+                return field_bincode<typename gt_type::underlying_field_type>::field_element_to_bytes(
+                    element.data, out_first, out_last);
+            }
+
+            template<typename InputIterator>
+            static inline typename std::enable_if<
+                std::is_same<chunk_type, typename std::iterator_traits<InputIterator>::value_type>::value,
+                std::pair<bool, gt_compressed_value_type>>::type
+                gt_compressed_from_bytes(InputIterator first, InputIterator last) {
+                std::pair<bool, typename gt_type::underlying_field_type::value_type> m =
+                    field_bincode<typename gt_type::underlying_field_type>::field_element_from_bytes(first, last);
+
+                return std::make_pair(m.first, gt_compressed_value_type(m.second));
+            }
+
+            /**
+             * Writes a cyclotomic subgroup element, e.g. a reduced pairing, in torus T2 form using
+             * gt_compressed_octets_num octets, half of the uncompressed size.
+             */
+            template<typename OutputIterator>
+            static inline typename std::enable_if<
+                std::is_same<chunk_type, typename std::iterator_traits<OutputIterator>::value_type>::value,
+                std::size_t>::type
+                gt_element_to_bytes_compressed(const typename gt_type::value_type &element, OutputIterator out_first,
+                                               OutputIterator out_last) {
+                return gt_compressed_to_bytes(gt_compressed_value_type::compress(element), out_first, out_last);
+            }
+
+            /**
+             * Reads an element written by gt_element_to_bytes_compressed. Any in-range input decodes to an
+             * element of the cyclotomic subgroup; membership in GT itself is not checked.
+             */
+            template<typename InputIterator>
+            static inline typename std::enable_if<
+                std::is_same<chunk_type, typename std::iterator_traits<InputIterator>::value_type>::value,
+                std::pair<bool, typename gt_type::value_type>>::type
+                gt_element_from_bytes_compressed(InputIterator first, InputIterator last) {
+                std::pair<bool, gt_compressed_value_type> m = gt_compressed_from_bytes(first, last);
+
+                return std::make_pair(m.first, m.first ? m.second.decompress() : gt_type::value_type::one());
+            }
+
             template<typename GroupType, typename OutputIterator>
             static inline typename std::enable_if<
                 std::is_same<g1_type, GroupType>::value || std::is_same<g2_type, GroupType>::value, std::size_t>::type
@@ -0,0 +1,165 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_MULTIEXP_BATCH_HPP
+#define CRYPTO3_ALGEBRA_MULTIEXP_BATCH_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/algebra/multiexp/detail/digits.hpp>
+#include <nil/crypto3/algebra/multiexp/streaming.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+
+            /**
+             * Computes k multi-exponentiations sharing one base vector: result[j] = sum_i scalars[j][i] * P_i.
+             *
+             * The bases are read once, in chunks. Every base of a chunk is loaded (and negated) once and then
+             * scattered, window by window, into k bucket sets of the current window only, instead of being
+             * re-read by k separate multiexp calls. The buckets are folded into per-window sums after each
+             * window of a chunk, so the state is k * 2^{window - 1} buckets, k sums per window and one chunk
+             * of at least 2^{window + 1} bases, regardless of the number of bases.
+             * Scalar vectors may be shorter than the base vector; missing scalars count as zero.
+             *
+             * @param window the Pippenger window, at least 2; 0 selects the multiexp_method_BDLO12 estimate
+             * for the number of bases
+             */
+            template<typename InputBaseIterator, typename ScalarVectors>
+            std::vector<typename std::iterator_traits<InputBaseIterator>::value_type>
+                batch_multiexp(InputBaseIterator bases_first, InputBaseIterator bases_last,
+                               const ScalarVectors &scalar_vectors, std::size_t window = 0) {
+
+                typedef typename std::iterator_traits<InputBaseIterator>::value_type base_value_type;
+                typedef typename base_value_type::group_type group_type;
+                typedef multiexp_stream<group_type> stream_type;
+                typedef typename stream_type::field_type field_type;
+                typedef typename stream_type::modulus_type modulus_type;
+
+                const std::size_t length = std::distance(bases_first, bases_last);
+                if (window == 0) {
+                    window = stream_type::default_window(length);
+                }
+                BOOST_ASSERT(window > 1 && window < 32);
+
+                const std::size_t windows = detail::signed_windows_count(field_type::modulus_bits, window);
+                const std::size_t buckets_count = std::size_t(1) << (window - 1);
+                const std::int64_t radix = std::int64_t(1) << window;
+                const std::int64_t half_radix = radix >> 1;
+                // folding the buckets costs 2 * buckets_count additions per window and chunk
+                const std::size_t chunk_size = std::max<std::size_t>(1024, 4 * buckets_count);
+
+                // scalars are converted once
+                std::vector<std::vector<modulus_type>> scalars;
+                for (auto it = std::begin(scalar_vectors); it != std::end(scalar_vectors); ++it) {
+                    scalars.emplace_back();
+                    for (auto scalar_it = std::begin(*it); scalar_it != std::end(*it); ++scalar_it) {
+                        scalars.back().emplace_back(scalar_it->data.template convert_to<modulus_type>());
+                    }
+                    BOOST_ASSERT(scalars.back().size() <= length);
+                }
+
+                const std::size_t k_count = scalars.size();
+                std::vector<base_value_type> buckets(k_count * buckets_count);
+                std::vector<std::vector<base_value_type>> window_sums(
+                    k_count, std::vector<base_value_type>(windows, base_value_type::zero()));
+
+                std::vector<base_value_type> chunk, negated_chunk;
+                // carries[j * chunk_size + i] is the recoding carry of scalars[j][offset + i] into the current window
+                std::vector<std::uint8_t> carries(k_count * chunk_size);
+
+                for (std::size_t offset = 0; offset < length; offset += chunk.size()) {
+                    chunk.clear();
+                    negated_chunk.clear();
+                    for (; chunk.size() < chunk_size && bases_first != bases_last; ++bases_first) {
+                        chunk.emplace_back(*bases_first);
+                        negated_chunk.emplace_back(-chunk.back());
+                    }
+                    std::fill(carries.begin(), carries.end(), 0);
+
+                    for (std::size_t k = 0; k < windows; ++k) {
+                        std::fill(buckets.begin(), buckets.end(), base_value_type::zero());
+
+                        for (std::size_t i = 0; i < chunk.size(); ++i) {
+                            if (chunk[i].is_zero()) {
+                                continue;
+                            }
+
+                            for (std::size_t j = 0; j < k_count; ++j) {
+                                if (offset + i >= scalars[j].size()) {
+                                    continue;
+                                }
+
+                                std::uint8_t &carry = carries[j * chunk_size + i];
+                                std::int64_t digit = static_cast<std::int64_t>(detail::get_window(
+                                                         scalars[j][offset + i], k * window, window)) +
+                                                     carry;
+                                carry = digit >= half_radix;
+                                if (carry) {
+                                    digit -= radix;
+                                }
+                                if (digit == 0) {
+                                    continue;
+                                }
+
+                                base_value_type &bucket = buckets[j * buckets_count + (digit > 0 ? digit : -digit) - 1];
+                                bucket = bucket + (digit > 0 ? chunk[i] : negated_chunk[i]);
+                            }
+                        }
+
+                        for (std::size_t j = 0; j < k_count; ++j) {
+                            base_value_type running_sum = base_value_type::zero();
+                            base_value_type window_sum = base_value_type::zero();
+                            for (std::size_t b = buckets_count; b-- > 0;) {
+                                running_sum = running_sum + buckets[j * buckets_count + b];
+                                window_sum = window_sum + running_sum;
+                            }
+                            window_sums[j][k] = window_sums[j][k] + window_sum;
+                        }
+                    }
+                }
+
+                std::vector<base_value_type> result(k_count, base_value_type::zero());
+                for (std::size_t j = 0; j < k_count; ++j) {
+                    for (std::size_t k = windows; k-- > 0;) {
+                        for (std::size_t b = 0; b < window && !result[j].is_zero(); ++b) {
+                            result[j] = result[j].doubled();
+                        }
+                        result[j] = result[j] + window_sums[j][k];
+                    }
+                }
+
+                return result;
+            }
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_MULTIEXP_BATCH_HPP
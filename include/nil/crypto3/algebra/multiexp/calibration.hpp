@@ -0,0 +1,192 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_MULTIEXP_CALIBRATION_HPP
+#define CRYPTO3_ALGEBRA_MULTIEXP_CALIBRATION_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <nil/crypto3/algebra/multiexp/multiexp.hpp>
+#include <nil/crypto3/algebra/multiexp/policies.hpp>
+#include <nil/crypto3/algebra/multiexp/tuning.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace detail {
+                template<typename Function>
+                double best_elapsed_nanoseconds(std::size_t repetitions, Function f) {
+                    double best = std::numeric_limits<double>::max();
+                    for (std::size_t i = 0; i < repetitions; ++i) {
+                        auto start = std::chrono::steady_clock::now();
+                        f();
+                        auto stop = std::chrono::steady_clock::now();
+                        best = std::min(
+                            best,
+                            double(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count()));
+                    }
+                    return best;
+                }
+
+                template<typename MultiexpMethod, typename BaseValueType, typename FieldValueType>
+                double time_multiexp(const std::vector<BaseValueType> &bases,
+                                     const std::vector<FieldValueType> &scalars,
+                                     std::size_t size,
+                                     std::size_t repetitions) {
+                    return best_elapsed_nanoseconds(repetitions, [&]() {
+                        MultiexpMethod::process(bases.cbegin(), bases.cbegin() + size, scalars.cbegin(),
+                                                scalars.cbegin() + size);
+                    });
+                }
+
+                template<typename BaseValueType, typename FieldValueType>
+                double time_multiexp_BDLO12(const std::vector<BaseValueType> &bases,
+                                            const std::vector<FieldValueType> &scalars,
+                                            std::size_t size,
+                                            std::size_t window,
+                                            std::size_t repetitions) {
+                    return best_elapsed_nanoseconds(repetitions, [&]() {
+                        policies::multiexp_method_BDLO12::process(bases.cbegin(), bases.cbegin() + size,
+                                                                  scalars.cbegin(), scalars.cbegin() + size,
+                                                                  window);
+                    });
+                }
+            }    // namespace detail
+
+            /**
+             * Benchmarks the multi-exponentiation methods on the host CPU for GroupType and returns the
+             * profile picking the fastest method and window for every power-of-two size up to
+             * 2^max_log_size, together with a fixed-base window table calibrated for windows up to
+             * max_fixed_base_window. The result is meant to be written with write_multiexp_tuning_profiles()
+             * and loaded through multiexp_tuning<GroupType> on startup.
+             */
+            template<typename GroupType, typename FieldType = typename GroupType::curve_type::scalar_field_type>
+            multiexp_tuning_profile calibrate_multiexp(std::size_t max_log_size = 16,
+                                                       std::size_t max_fixed_base_window = 16,
+                                                       std::size_t repetitions = 3) {
+                typedef typename GroupType::value_type base_value_type;
+                typedef typename FieldType::value_type field_value_type;
+
+                const std::size_t max_size = std::size_t(1) << max_log_size;
+
+                // distinct multiples of a random point are as good as random points for timing purposes
+                std::vector<base_value_type> bases;
+                std::vector<field_value_type> scalars;
+                bases.reserve(max_size);
+                scalars.reserve(max_size);
+
+                const base_value_type g = random_element<GroupType>();
+                base_value_type p = g;
+                for (std::size_t i = 0; i < max_size; ++i) {
+                    bases.emplace_back(p);
+                    scalars.emplace_back(random_element<FieldType>());
+                    p = p + g;
+                }
+
+                multiexp_tuning_profile profile;
+
+                for (std::size_t log_size = 1; log_size <= max_log_size; ++log_size) {
+                    const std::size_t size = std::size_t(1) << log_size;
+
+                    multiexp_tuning_range best = {size, multiexp_method_type::bos_coster, 0};
+                    double best_time = detail::time_multiexp<policies::multiexp_method_bos_coster>(
+                        bases, scalars, size, repetitions);
+
+                    if (log_size <= 10) {
+                        double time = detail::time_multiexp<policies::multiexp_method_naive_plain>(
+                            bases, scalars, size, repetitions);
+                        if (time < best_time) {
+                            best = {size, multiexp_method_type::naive_plain, 0};
+                            best_time = time;
+                        }
+                    }
+
+                    // explore the neighbourhood of the compiled-in estimate
+                    const std::size_t default_window = log_size - (log_size / 3 - 2);
+                    for (std::size_t window = std::max<std::size_t>(default_window, 4) - 3;
+                         window <= std::min<std::size_t>(default_window + 3, 20);
+                         ++window) {
+                        double time = detail::time_multiexp_BDLO12(bases, scalars, size, window, repetitions);
+                        if (time < best_time) {
+                            best = {size, multiexp_method_type::BDLO12, window};
+                            best_time = time;
+                        }
+                    }
+
+                    if (profile.ranges.empty() || profile.ranges.back().method != best.method ||
+                        profile.ranges.back().window != best.window) {
+                        profile.ranges.push_back(best);
+                    }
+                }
+
+                // fixed-base exponentiation: cost(window, n) = table(window) + n * exp(window)
+                const std::size_t scalar_size = FieldType::modulus_bits;
+                std::vector<double> table_time(max_fixed_base_window), exp_time(max_fixed_base_window);
+
+                for (std::size_t window = 1; window <= max_fixed_base_window; ++window) {
+                    flat_window_table<GroupType> table;
+                    table_time[window - 1] = detail::best_elapsed_nanoseconds(
+                        1, [&]() { table = get_flat_window_table<GroupType>(scalar_size, window, g); });
+
+                    const std::size_t samples = std::min<std::size_t>(scalars.size(), 64);
+                    exp_time[window - 1] = detail::best_elapsed_nanoseconds(repetitions, [&]() {
+                                               for (std::size_t i = 0; i < samples; ++i) {
+                                                   windowed_exp<GroupType, FieldType>(scalar_size, window, table,
+                                                                                      scalars[i]);
+                                               }
+                                           }) /
+                                           samples;
+                }
+
+                profile.fixed_base_exp_window_table.assign(max_fixed_base_window, 0);
+                std::size_t last_winner = 0;
+                for (double n = 1; n < double(std::size_t(1) << 32); n = std::ceil(n * 1.05)) {
+                    std::size_t winner = 0;
+                    for (std::size_t i = 1; i < max_fixed_base_window; ++i) {
+                        if (table_time[i] + n * exp_time[i] < table_time[winner] + n * exp_time[winner]) {
+                            winner = i;
+                        }
+                    }
+
+                    // keep the table monotone: timing noise must not switch back to a smaller window
+                    if (winner > last_winner || (winner == 0 && last_winner == 0)) {
+                        if (profile.fixed_base_exp_window_table[winner] == 0) {
+                            profile.fixed_base_exp_window_table[winner] = std::size_t(n);
+                        }
+                        last_winner = winner;
+                    }
+                }
+
+                return profile;
+            }
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_MULTIEXP_CALIBRATION_HPP
@@ -0,0 +1,124 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_MULTIEXP_DETAIL_DIGITS_HPP
+#define CRYPTO3_ALGEBRA_MULTIEXP_DETAIL_DIGITS_HPP
+
+#include <climits>
+#include <cstdint>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/multiprecision/number.hpp>
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace detail {
+
+                /**
+                 * Extracts the window of `width` bits starting at bit `offset` of a fixed-width integer.
+                 * Reads at most two limbs of the backend instead of testing every bit separately.
+                 * Requires width to be less than the number of bits in std::size_t.
+                 */
+                template<typename Backend, multiprecision::expression_template_option ExpressionTemplates>
+                inline std::size_t get_window(const multiprecision::number<Backend, ExpressionTemplates> &n,
+                                              std::size_t offset,
+                                              std::size_t width) {
+                    typedef typename Backend::limb_type limb_type;
+                    constexpr std::size_t limb_bits = sizeof(limb_type) * CHAR_BIT;
+
+                    const std::size_t limb_index = offset / limb_bits;
+                    const std::size_t bit_index = offset % limb_bits;
+                    const std::size_t limbs_count = n.backend().size();
+                    const limb_type *limbs = n.backend().limbs();
+
+                    if (limb_index >= limbs_count) {
+                        return 0;
+                    }
+
+                    std::size_t result = static_cast<std::size_t>(limbs[limb_index] >> bit_index);
+                    if (bit_index + width > limb_bits && limb_index + 1 < limbs_count) {
+                        result |= static_cast<std::size_t>(limbs[limb_index + 1] << (limb_bits - bit_index));
+                    }
+
+                    return result & ((std::size_t(1) << width) - 1);
+                }
+
+                /**
+                 * Number of signed windows of width c >= 2 required to recode a scalar of scalar_bits bits.
+                 * The windows cover at least scalar_bits + 2 bits, so the top window starts from a value
+                 * below 2^{c-2} and cannot carry out even when the window below it does.
+                 */
+                constexpr inline std::size_t signed_windows_count(std::size_t scalar_bits, std::size_t c) {
+                    return (scalar_bits + 1) / c + 1;
+                }
+
+                /**
+                 * Recodes a scalar into signed base-2^c digits in [-2^{c-1}, 2^{c-1}), least significant first.
+                 * Signed digits halve the number of buckets a Pippenger-style pass needs, since negating an
+                 * elliptic curve point (or conjugating a unitary field element) is free.
+                 */
+                template<typename Backend, multiprecision::expression_template_option ExpressionTemplates>
+                inline void signed_window_digits(const multiprecision::number<Backend, ExpressionTemplates> &n,
+                                                 std::size_t c,
+                                                 std::size_t num_windows,
+                                                 std::int64_t *out) {
+                    BOOST_ASSERT(c > 1);
+
+                    const std::int64_t radix = std::int64_t(1) << c;
+                    const std::int64_t half_radix = radix >> 1;
+                    std::int64_t carry = 0;
+
+                    for (std::size_t k = 0; k < num_windows; ++k) {
+                        std::int64_t digit = static_cast<std::int64_t>(get_window(n, k * c, c)) + carry;
+                        if (digit >= half_radix) {
+                            digit -= radix;
+                            carry = 1;
+                        } else {
+                            carry = 0;
+                        }
+                        out[k] = digit;
+                    }
+
+                    BOOST_ASSERT(carry == 0);
+                }
+
+                template<typename Backend, multiprecision::expression_template_option ExpressionTemplates>
+                inline std::vector<std::int64_t>
+                    signed_window_digits(const multiprecision::number<Backend, ExpressionTemplates> &n,
+                                         std::size_t c,
+                                         std::size_t num_windows) {
+                    std::vector<std::int64_t> result(num_windows);
+                    signed_window_digits(n, c, num_windows, result.data());
+                    return result;
+                }
+            }    // namespace detail
+        }        // namespace algebra
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_MULTIEXP_DETAIL_DIGITS_HPP
@@ -0,0 +1,122 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_MULTIEXP_DETAIL_POINT_CODEC_HPP
+#define CRYPTO3_ALGEBRA_MULTIEXP_DETAIL_POINT_CODEC_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include <nil/crypto3/algebra/marshalling.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace detail {
+
+                template<typename ValueType, typename = void>
+                struct has_is_well_formed : std::false_type { };
+
+                template<typename ValueType>
+                struct has_is_well_formed<ValueType, decltype(void(std::declval<const ValueType &>().is_well_formed()))>
+                    : std::true_type { };
+
+                template<typename ValueType>
+                bool is_well_formed_point(const ValueType &point, std::true_type) {
+                    return point.is_well_formed();
+                }
+
+                // groups without a curve equation check (e.g. edwards183) are accepted as decoded
+                template<typename ValueType>
+                bool is_well_formed_point(const ValueType &, std::false_type) {
+                    return true;
+                }
+
+                /**
+                 * Fixed-size encoding of curve points used by the multiexp tables and streams: an infinity
+                 * flag octet followed by the affine X and Y coordinates in field_bincode form.
+                 */
+                template<typename GroupType>
+                struct affine_point_codec {
+                    typedef typename GroupType::value_type value_type;
+                    typedef typename GroupType::underlying_field_type underlying_field_type;
+                    typedef typename underlying_field_type::value_type underlying_field_value_type;
+                    typedef nil::marshalling::field_bincode<underlying_field_type> coordinate_bincode;
+
+                    typedef std::uint8_t chunk_type;
+
+                    constexpr static const std::size_t coordinate_octets_num = coordinate_bincode::field_octets_num;
+                    constexpr static const std::size_t octets_num = 1 + 2 * coordinate_octets_num;
+
+                    /**
+                     * @param point is expected to be in the special form produced by batch_to_special, i.e. with Z = 1
+                     */
+                    static chunk_type *encode(const value_type &point, chunk_type *out) {
+                        if (point.is_zero()) {
+                            std::fill(out, out + octets_num, chunk_type(0));
+                            out[0] = 1;
+                        } else {
+                            out[0] = 0;
+                            coordinate_bincode::field_element_to_bytes(point.X, out + 1,
+                                                                       out + 1 + coordinate_octets_num);
+                            coordinate_bincode::field_element_to_bytes(point.Y, out + 1 + coordinate_octets_num,
+                                                                       out + octets_num);
+                        }
+                        return out + octets_num;
+                    }
+
+                    /**
+                     * The first element of the result is false for malformed coordinates and for points off the curve.
+                     */
+                    static std::pair<bool, value_type> decode(const chunk_type *in) {
+                        if (in[0] == 1) {
+                            return std::make_pair(true, value_type::zero());
+                        }
+
+                        std::pair<bool, underlying_field_value_type> x =
+                            coordinate_bincode::field_element_from_bytes(in + 1, in + 1 + coordinate_octets_num);
+                        std::pair<bool, underlying_field_value_type> y = coordinate_bincode::field_element_from_bytes(
+                            in + 1 + coordinate_octets_num, in + octets_num);
+
+                        const value_type point(x.second, y.second, underlying_field_value_type::one());
+
+                        return std::make_pair(in[0] == 0 && x.first && y.first &&
+                                                  is_well_formed_point(point, has_is_well_formed<value_type>()),
+                                              point);
+                    }
+                };
+
+                template<typename GroupType>
+                constexpr std::size_t const affine_point_codec<GroupType>::coordinate_octets_num;
+
+                template<typename GroupType>
+                constexpr std::size_t const affine_point_codec<GroupType>::octets_num;
+            }    // namespace detail
+        }        // namespace algebra
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_MULTIEXP_DETAIL_POINT_CODEC_HPP
@@ -0,0 +1,189 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_MULTIEXP_DIGIT_PLAN_HPP
+#define CRYPTO3_ALGEBRA_MULTIEXP_DIGIT_PLAN_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <future>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/algebra/multiexp/detail/digits.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+
+            /**
+             * Scalars recoded once into signed base-2^c digits, so that several multi-exponentiations with
+             * the same scalars (e.g. the G1 and G2 parts of a Groth16 proof) skip the conversion out of
+             * Montgomery form and the digit extraction. A plan only depends on the scalars and the window,
+             * so it can be kept across calls while the witness does not change.
+             */
+            template<typename FieldType>
+            class multiexp_digit_plan {
+            public:
+                typedef FieldType field_type;
+                typedef typename field_type::value_type field_value_type;
+                typedef typename field_type::modulus_type modulus_type;
+                typedef std::int32_t digit_type;
+
+                /**
+                 * @param window the window width; 0 selects the multiexp_method_BDLO12 estimate
+                 */
+                template<typename InputFieldIterator>
+                multiexp_digit_plan(InputFieldIterator scalars_first, InputFieldIterator scalars_last,
+                                    std::size_t window = 0) :
+                    length(std::distance(scalars_first, scalars_last)),
+                    c(window != 0 ? window : default_window(length)),
+                    windows_count(detail::signed_windows_count(field_type::modulus_bits, c)),
+                    digits(length * windows_count, 0) {
+
+                    BOOST_ASSERT(c > 1 && c < 32);
+
+                    std::vector<std::int64_t> row(windows_count);
+                    digit_type *out = digits.data();
+                    for (; scalars_first != scalars_last; ++scalars_first, out += windows_count) {
+                        const modulus_type scalar = scalars_first->data.template convert_to<modulus_type>();
+                        if (scalar.is_zero()) {
+                            continue;
+                        }
+
+                        detail::signed_window_digits(scalar, c, windows_count, row.data());
+                        std::copy(row.begin(), row.end(), out);
+                    }
+                }
+
+                std::size_t size() const {
+                    return length;
+                }
+
+                std::size_t window() const {
+                    return c;
+                }
+
+                std::size_t windows() const {
+                    return windows_count;
+                }
+
+                /**
+                 * @return the k-th signed digit of the i-th scalar
+                 */
+                digit_type digit(std::size_t i, std::size_t k) const {
+                    return digits[i * windows_count + k];
+                }
+
+            private:
+                static std::size_t default_window(std::size_t length) {
+                    const std::size_t log2_length = length > 1 ? std::log2(length) : 1;
+                    return std::max<std::size_t>(2, log2_length - (log2_length / 3 - 2));
+                }
+
+                std::size_t length;
+                std::size_t c;
+                std::size_t windows_count;
+                std::vector<digit_type> digits;
+            };
+
+            /**
+             * Pippenger multi-exponentiation driven by a precomputed digit plan, window by window with
+             * 2^{c-1} buckets and free negation of the bases for negative digits.
+             */
+            template<typename FieldType, typename InputBaseIterator>
+            typename std::iterator_traits<InputBaseIterator>::value_type
+                multiexp(const multiexp_digit_plan<FieldType> &plan, InputBaseIterator bases_first,
+                         InputBaseIterator bases_last) {
+
+                typedef typename std::iterator_traits<InputBaseIterator>::value_type base_value_type;
+
+                const std::size_t length = std::distance(bases_first, bases_last);
+                BOOST_ASSERT(length == plan.size());
+
+                const std::size_t c = plan.window();
+                const std::size_t buckets_count = std::size_t(1) << (c - 1);
+
+                std::vector<base_value_type> buckets(buckets_count);
+                base_value_type result = base_value_type::zero();
+
+                for (std::size_t k = plan.windows(); k-- > 0;) {
+                    for (std::size_t i = 0; i < c && !result.is_zero(); ++i) {
+                        result = result.doubled();
+                    }
+
+                    std::fill(buckets.begin(), buckets.end(), base_value_type::zero());
+
+                    InputBaseIterator base_it = bases_first;
+                    for (std::size_t i = 0; i < length; ++i, ++base_it) {
+                        const typename multiexp_digit_plan<FieldType>::digit_type digit = plan.digit(i, k);
+                        if (digit > 0) {
+                            buckets[digit - 1] = buckets[digit - 1] + *base_it;
+                        } else if (digit < 0) {
+                            buckets[-digit - 1] = buckets[-digit - 1] - *base_it;
+                        }
+                    }
+
+                    base_value_type running_sum = base_value_type::zero();
+                    base_value_type window_sum = base_value_type::zero();
+                    for (std::size_t b = buckets_count; b-- > 0;) {
+                        running_sum = running_sum + buckets[b];
+                        window_sum = window_sum + running_sum;
+                    }
+                    result = result + window_sum;
+                }
+
+                return result;
+            }
+
+            /**
+             * Runs the multi-exponentiations of one digit plan against bases of two groups, typically G1 and
+             * G2, on separate threads when concurrent is set.
+             */
+            template<typename FieldType, typename InputFirstBaseIterator, typename InputSecondBaseIterator>
+            std::pair<typename std::iterator_traits<InputFirstBaseIterator>::value_type,
+                      typename std::iterator_traits<InputSecondBaseIterator>::value_type>
+                multiexp(const multiexp_digit_plan<FieldType> &plan,
+                         InputFirstBaseIterator first_bases_first, InputFirstBaseIterator first_bases_last,
+                         InputSecondBaseIterator second_bases_first, InputSecondBaseIterator second_bases_last,
+                         bool concurrent = true) {
+
+                typedef typename std::iterator_traits<InputSecondBaseIterator>::value_type second_value_type;
+
+                std::future<second_value_type> second = std::async(
+                    concurrent ? std::launch::async : std::launch::deferred,
+                    [&]() { return multiexp(plan, second_bases_first, second_bases_last); });
+
+                auto first = multiexp(plan, first_bases_first, first_bases_last);
+
+                return std::make_pair(first, second.get());
+            }
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_MULTIEXP_DIGIT_PLAN_HPP
@@ -0,0 +1,283 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_MULTIEXP_GT_MULTIEXP_HPP
+#define CRYPTO3_ALGEBRA_MULTIEXP_GT_MULTIEXP_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/multiprecision/number.hpp>
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+
+#include <nil/crypto3/algebra/fields/detail/exponentiation.hpp>
+#include <nil/crypto3/algebra/multiexp/detail/digits.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace detail {
+                /**
+                 * Frobenius decomposition of exponents of the order-r subgroup of the target group.
+                 * On that subgroup the p-power Frobenius map acts as exponentiation by p mod r, so with
+                 * s = min(p mod r, r - p mod r) and sigma = Frobenius (followed by a unitary inversion when
+                 * s = r - p mod r), g^e = prod_j sigma^j(g)^{e_j}, where e_j are the base-s digits of e.
+                 * For BLS12 s = |z| and an exponent splits into 4 digits of 64 bits, for BN and MNT curves into
+                 * 2 half-width digits and a short third one.
+                 */
+                template<typename CurveType>
+                struct gt_frobenius_decomposition {
+                    typedef typename CurveType::gt_type gt_field_type;
+                    typedef typename gt_field_type::value_type gt_value_type;
+                    typedef typename CurveType::scalar_field_type scalar_field_type;
+                    typedef typename scalar_field_type::modulus_type modulus_type;
+
+                    constexpr static const std::size_t common_bits =
+                        std::max(gt_field_type::modulus_bits, scalar_field_type::modulus_bits);
+                    typedef multiprecision::number<multiprecision::backends::cpp_int_backend<
+                        common_bits, common_bits, multiprecision::unsigned_magnitude, multiprecision::unchecked, void>>
+                        common_type;
+
+                    gt_frobenius_decomposition() : inverse_frobenius(false), digits_count(0) {
+                        const common_type p(gt_field_type::modulus);
+                        const common_type r(scalar_field_type::modulus);
+                        const common_type q = p % r;
+
+                        inverse_frobenius = q > r - q;
+                        base = (inverse_frobenius ? common_type(r - q) : q).template convert_to<modulus_type>();
+
+                        // number of base-s digits of r - 1
+                        modulus_type rest = scalar_field_type::modulus - 1;
+                        while (!rest.is_zero()) {
+                            rest /= base;
+                            ++digits_count;
+                        }
+                        digit_bits = multiprecision::msb(base) + 1;
+                    }
+
+                    gt_value_type sigma(const gt_value_type &g) const {
+                        const gt_value_type frobenius = g.Frobenius_map(1);
+                        return inverse_frobenius ? frobenius.unitary_inversed() : frobenius;
+                    }
+
+                    void digits(modulus_type e, modulus_type *out) const {
+                        for (std::size_t j = 0; j < digits_count; ++j) {
+                            out[j] = e % base;
+                            e /= base;
+                        }
+                    }
+
+                    bool inverse_frobenius;
+                    modulus_type base;
+                    std::size_t digits_count;
+                    std::size_t digit_bits;
+                };
+
+                /**
+                 * Window width minimizing the number of target group multiplications for n digits
+                 * of digit_bits bits: every window costs n bucket products and 2^c aggregation products.
+                 */
+                inline std::size_t gt_multiexp_window(std::size_t n, std::size_t digit_bits) {
+                    std::size_t best = 2;
+                    std::size_t best_cost = std::size_t(-1);
+                    for (std::size_t c = 2; c < 20; ++c) {
+                        const std::size_t cost = signed_windows_count(digit_bits, c) * (n + (std::size_t(1) << c));
+                        if (cost < best_cost) {
+                            best = c;
+                            best_cost = cost;
+                        }
+                    }
+                    return best;
+                }
+
+                /**
+                 * prod_j bases[j]^{d_j} with Pippenger's bucket method, where window k of the signed c-bit
+                 * digits of d_j is stored at digits[j * windows + k], least significant window first. Window
+                 * shifts are cyclotomic squarings and negative digits use the unitary inverse, so all bases must
+                 * lie in the cyclotomic subgroup, but not necessarily in GT.
+                 */
+                template<typename GTValueType>
+                GTValueType cyclotomic_bucket_product(const std::vector<GTValueType> &bases,
+                                                      const std::vector<std::int64_t> &digits, std::size_t windows,
+                                                      std::size_t c) {
+                    typedef GTValueType gt_value_type;
+
+                    const std::size_t n = bases.size();
+                    const std::size_t buckets_count = std::size_t(1) << (c - 1);
+                    std::vector<gt_value_type> buckets(buckets_count);
+                    std::vector<bool> bucket_nonempty(buckets_count);
+
+                    gt_value_type result = gt_value_type::one();
+
+                    for (std::size_t k = windows; k-- > 0;) {
+                        for (std::size_t i = 0; i < c; ++i) {
+                            result = result.cyclotomic_squared();
+                        }
+
+                        std::fill(bucket_nonempty.begin(), bucket_nonempty.end(), false);
+
+                        for (std::size_t j = 0; j < n; ++j) {
+                            const std::int64_t digit = digits[j * windows + k];
+                            if (digit == 0) {
+                                continue;
+                            }
+
+                            const std::size_t id = (digit > 0 ? digit : -digit) - 1;
+                            const gt_value_type factor = digit > 0 ? bases[j] : bases[j].unitary_inversed();
+
+                            if (bucket_nonempty[id]) {
+                                buckets[id] = buckets[id] * factor;
+                            } else {
+                                buckets[id] = factor;
+                                bucket_nonempty[id] = true;
+                            }
+                        }
+
+                        // prod_id buckets[id]^{id + 1} through running products
+                        gt_value_type running_product = gt_value_type::one();
+                        gt_value_type window_product = gt_value_type::one();
+                        bool running_nonempty = false;
+
+                        for (std::size_t id = buckets_count; id-- > 0;) {
+                            if (bucket_nonempty[id]) {
+                                running_product = running_nonempty ? running_product * buckets[id] : buckets[id];
+                                running_nonempty = true;
+                            }
+                            if (running_nonempty) {
+                                window_product = window_product * running_product;
+                            }
+                        }
+
+                        result = result * window_product;
+                    }
+
+                    return result;
+                }
+            }    // namespace detail
+
+            /**
+             * Exponentiation g^e in the target group GT of CurveType. The exponent is split by
+             * detail::gt_frobenius_decomposition into short digits e_j with g^e = prod_j sigma^j(g)^{e_j}
+             * (4 digits of 64 bits for BLS12), which are then evaluated as a joint signed wNAF sharing one chain
+             * of cyclotomic squarings, so the squarings drop to the length of the digits.
+             *
+             * g must lie in the order-r subgroup, i.e. be an output of a final exponentiation.
+             */
+            template<typename CurveType>
+            typename CurveType::gt_type::value_type gt_exp(const typename CurveType::gt_type::value_type &g,
+                                                           const typename CurveType::scalar_field_type::value_type &e) {
+                typedef detail::gt_frobenius_decomposition<CurveType> decomposition_type;
+                typedef typename decomposition_type::gt_value_type gt_value_type;
+                typedef typename decomposition_type::modulus_type modulus_type;
+
+                const decomposition_type decomposition;
+                std::vector<modulus_type> exponent_digits(decomposition.digits_count);
+                decomposition.digits(e.data.template convert_to<modulus_type>(), exponent_digits.data());
+
+                const std::size_t window =
+                    fields::detail::cyclotomic_wnaf_window(exponent_digits.cbegin(), exponent_digits.cend());
+
+                std::vector<std::vector<gt_value_type>> tables;
+                std::vector<std::vector<long>> nafs;
+                tables.reserve(exponent_digits.size());
+                nafs.reserve(exponent_digits.size());
+
+                gt_value_type base = g;
+                for (std::size_t j = 0; j < exponent_digits.size(); ++j) {
+                    if (j > 0) {
+                        base = decomposition.sigma(base);
+                    }
+                    tables.emplace_back(fields::detail::cyclotomic_wnaf_table(base, window));
+                    nafs.emplace_back(multiprecision::find_wnaf(window, exponent_digits[j]));
+                }
+
+                return fields::detail::cyclotomic_wnaf_product(tables, nafs);
+            }
+
+            /**
+             * Multi-exponentiation prod_i g_i^{e_i} in the target group GT of CurveType
+             * (fp12_2over3over2 for BLS12 and BN curves, fp6_2over3 for MNT6, fp4 for MNT4).
+             *
+             * Pippenger's method over the multiplicative group: bucket accumulation is done with
+             * multiplications, window shifts with cyclotomic squarings, and negative signed digits use the
+             * free unitary inverse. Each exponent is first split by detail::gt_frobenius_decomposition,
+             * which shortens the digits to the bit length of p mod r at the cost of a few Frobenius maps.
+             *
+             * All g_i must lie in the order-r subgroup, i.e. be outputs of a final exponentiation.
+             *
+             * @param window the window width; 0 selects it from the instance size
+             */
+            template<typename CurveType, typename InputGTIterator, typename InputFieldIterator>
+            typename CurveType::gt_type::value_type gt_multiexp(InputGTIterator g_first, InputGTIterator g_last,
+                                                                InputFieldIterator e_first, InputFieldIterator e_last,
+                                                                std::size_t window = 0) {
+                typedef detail::gt_frobenius_decomposition<CurveType> decomposition_type;
+                typedef typename decomposition_type::gt_value_type gt_value_type;
+                typedef typename decomposition_type::modulus_type modulus_type;
+
+                const std::size_t length = std::distance(g_first, g_last);
+                BOOST_ASSERT(length == std::size_t(std::distance(e_first, e_last)));
+
+                if (length == 0) {
+                    return gt_value_type::one();
+                }
+
+                const decomposition_type decomposition;
+                const std::size_t m = decomposition.digits_count;
+                const std::size_t n = length * m;
+                const std::size_t c = window != 0 ? window : detail::gt_multiexp_window(n, decomposition.digit_bits);
+                BOOST_ASSERT(c > 1 && c < 32);
+
+                const std::size_t windows = detail::signed_windows_count(decomposition.digit_bits, c);
+
+                // bases g_i, sigma(g_i), sigma^2(g_i), ... and their signed digits
+                std::vector<gt_value_type> bases;
+                bases.reserve(n);
+                std::vector<std::int64_t> digits(n * windows);
+                std::vector<modulus_type> exponent_digits(m);
+
+                for (std::size_t i = 0; i < length; ++i, ++g_first, ++e_first) {
+                    decomposition.digits(e_first->data.template convert_to<modulus_type>(), exponent_digits.data());
+
+                    gt_value_type g = *g_first;
+                    for (std::size_t j = 0; j < m; ++j) {
+                        if (j > 0) {
+                            g = decomposition.sigma(g);
+                        }
+                        bases.emplace_back(g);
+                        detail::signed_window_digits(exponent_digits[j], c, windows, &digits[(i * m + j) * windows]);
+                    }
+                }
+
+                return detail::cyclotomic_bucket_product(bases, digits, windows, c);
+            }
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_MULTIEXP_GT_MULTIEXP_HPP
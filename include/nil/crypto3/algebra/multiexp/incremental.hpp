@@ -0,0 +1,181 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_MULTIEXP_INCREMENTAL_HPP
+#define CRYPTO3_ALGEBRA_MULTIEXP_INCREMENTAL_HPP
+
+#include <iterator>
+#include <map>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/algebra/multiexp/multiexp.hpp>
+#include <nil/crypto3/algebra/multiexp/policies.hpp>
+#include <nil/crypto3/algebra/wnaf.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+
+            /**
+             * Vector commitment C = sum_i s_i * G_i maintained under sparse updates.
+             *
+             * update() only records the new value of s_i. Pending updates are applied by flush() as
+             * C += sum (s_i' - s_i) * G_i, either as one small multi-exponentiation over the changed
+             * positions or, once enable_wnaf_tables() was called, with per-base wNAF tables that are built
+             * the first time a position changes and reused afterwards. The cost of an update therefore
+             * depends on the number of changed positions only, not on the length of the vector.
+             */
+            template<typename GroupType,
+                     typename FieldType = typename GroupType::curve_type::scalar_field_type,
+                     typename MultiexpMethod = policies::multiexp_method_BDLO12>
+            class incremental_commitment {
+            public:
+                typedef GroupType group_type;
+                typedef FieldType field_type;
+                typedef typename group_type::value_type value_type;
+                typedef typename field_type::value_type field_value_type;
+                typedef typename field_type::modulus_type modulus_type;
+
+                template<typename InputBaseIterator>
+                incremental_commitment(InputBaseIterator bases_first, InputBaseIterator bases_last) :
+                    bases(bases_first, bases_last), scalars(bases.size(), field_value_type::zero()),
+                    current(value_type::zero()), wnaf_window(0) {
+                }
+
+                template<typename InputBaseIterator, typename InputFieldIterator>
+                incremental_commitment(InputBaseIterator bases_first, InputBaseIterator bases_last,
+                                       InputFieldIterator scalars_first, InputFieldIterator scalars_last) :
+                    bases(bases_first, bases_last), scalars(scalars_first, scalars_last), wnaf_window(0) {
+                    BOOST_ASSERT(bases.size() == scalars.size());
+                    current = multiexp<MultiexpMethod>(bases.cbegin(), bases.cend(), scalars.cbegin(),
+                                                       scalars.cend(), 1);
+                }
+
+                std::size_t size() const {
+                    return bases.size();
+                }
+
+                /**
+                 * Switches flush() to per-base wNAF tables of the given window, built lazily for the
+                 * positions that get updated.
+                 */
+                void enable_wnaf_tables(std::size_t window) {
+                    BOOST_ASSERT(window > 0);
+                    wnaf_window = window;
+                    wnaf_tables.clear();
+                }
+
+                /**
+                 * Schedules s_index := value. Several updates of one position before a flush() collapse
+                 * into a single delta.
+                 */
+                void update(std::size_t index, const field_value_type &value) {
+                    BOOST_ASSERT(index < bases.size());
+                    pending[index] = value;
+                }
+
+                std::size_t pending_updates() const {
+                    return pending.size();
+                }
+
+                /**
+                 * @return the value of s_index, including pending updates
+                 */
+                const field_value_type &scalar(std::size_t index) const {
+                    typename std::map<std::size_t, field_value_type>::const_iterator it = pending.find(index);
+                    return it != pending.end() ? it->second : scalars[index];
+                }
+
+                void flush() {
+                    if (pending.empty()) {
+                        return;
+                    }
+
+                    if (wnaf_window != 0) {
+                        for (const auto &entry : pending) {
+                            const field_value_type delta = entry.second - scalars[entry.first];
+                            if (delta != field_value_type::zero()) {
+                                current = current + fixed_window_wnaf_exp(
+                                                        wnaf_window, wnaf_table(entry.first),
+                                                        delta.data.template convert_to<modulus_type>());
+                            }
+                            scalars[entry.first] = entry.second;
+                        }
+                    } else {
+                        std::vector<value_type> delta_bases;
+                        std::vector<field_value_type> deltas;
+                        delta_bases.reserve(pending.size());
+                        deltas.reserve(pending.size());
+
+                        for (const auto &entry : pending) {
+                            const field_value_type delta = entry.second - scalars[entry.first];
+                            if (delta != field_value_type::zero()) {
+                                delta_bases.emplace_back(bases[entry.first]);
+                                deltas.emplace_back(delta);
+                            }
+                            scalars[entry.first] = entry.second;
+                        }
+
+                        if (!deltas.empty()) {
+                            current = current + multiexp<MultiexpMethod>(delta_bases.cbegin(), delta_bases.cend(),
+                                                                         deltas.cbegin(), deltas.cend(), 1);
+                        }
+                    }
+
+                    pending.clear();
+                }
+
+                /**
+                 * @return the commitment to the current vector, after applying pending updates
+                 */
+                const value_type &commitment() {
+                    flush();
+                    return current;
+                }
+
+            private:
+                const std::vector<value_type> &wnaf_table(std::size_t index) {
+                    std::vector<value_type> &table = wnaf_tables[index];
+                    if (table.empty()) {
+                        table = fixed_window_wnaf_table(wnaf_window, bases[index]);
+                    }
+                    return table;
+                }
+
+                std::vector<value_type> bases;
+                std::vector<field_value_type> scalars;
+                value_type current;
+
+                std::map<std::size_t, field_value_type> pending;
+
+                std::size_t wnaf_window;
+                std::map<std::size_t, std::vector<value_type>> wnaf_tables;
+            };
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_MULTIEXP_INCREMENTAL_HPP
@@ -27,8 +27,12 @@
 #ifndef CRYPTO3_ALGEBRA_INNER_PRODUCT_HPP
 #define CRYPTO3_ALGEBRA_INNER_PRODUCT_HPP
 
+#include <iterator>
 #include <vector>
 
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/algebra/algorithms/pair.hpp>
 #include <nil/crypto3/algebra/multiexp/multiexp.hpp>
 #include <nil/crypto3/algebra/multiexp/policies.hpp>
 
@@ -36,12 +40,77 @@ namespace nil {
     namespace crypto3 {
         namespace algebra {
 
-            template<typename InputBaseIterator>
+            /**
+             * Inner product <A, b> = sum_i b_i * A_i of a vector of group elements and a vector of scalars,
+             * i.e. a multi-exponentiation with MultiexpMethod.
+             */
+            template<typename MultiexpMethod = policies::multiexp_method_BDLO12, typename InputBaseIterator,
+                     typename InputFieldIterator>
             inline typename std::iterator_traits<InputBaseIterator>::value_type inner_product(InputBaseIterator a_begin,
                                                                                               InputBaseIterator a_end,
-                                                                                              InputBaseIterator b_begin,
-                                                                                              InputBaseIterator b_end) {
-                return multiexp<policies::multiexp_method_naive_plain>(a_begin, a_end, b_begin, b_end, 1);
+                                                                                              InputFieldIterator b_begin,
+                                                                                              InputFieldIterator b_end) {
+                return multiexp<MultiexpMethod>(a_begin, a_end, b_begin, b_end, 1);
+            }
+
+            namespace detail {
+                /**
+                 * Product of the Miller loops of (A_i, B_i) without final exponentiation. Pairs with a zero
+                 * G1 element are skipped, since they contribute the identity.
+                 */
+                template<typename PairingCurveType, typename InputG1Iterator, typename InputG2PrecompIterator>
+                typename PairingCurveType::pairing::gt_type::value_type
+                    miller_loop_product(InputG1Iterator a_begin, InputG1Iterator a_end,
+                                        InputG2PrecompIterator b_prec_begin) {
+                    typedef typename PairingCurveType::pairing pairing_policy;
+
+                    std::vector<typename pairing_policy::g1_precomp> a_prec;
+                    std::vector<const typename pairing_policy::g2_precomp *> b_prec;
+
+                    for (; a_begin != a_end; ++a_begin, ++b_prec_begin) {
+                        if (a_begin->is_zero()) {
+                            continue;
+                        }
+                        a_prec.emplace_back(pairing_policy::precompute_g1(*a_begin));
+                        b_prec.emplace_back(&*b_prec_begin);
+                    }
+
+                    // all loops share one chain of squarings
+                    return pairing_policy::multi_miller_loop(a_prec, b_prec);
+                }
+            }    // namespace detail
+
+            /**
+             * Pairing inner product prod_i e(A_i, B_i) with G2 elements precomputed by
+             * PairingCurveType::pairing::precompute_g2. All Miller loops share one final exponentiation.
+             */
+            template<typename PairingCurveType, typename InputG1Iterator, typename InputG2PrecompIterator>
+            typename PairingCurveType::pairing::gt_type::value_type
+                pairing_inner_product_precomputed(InputG1Iterator a_begin, InputG1Iterator a_end,
+                                                  InputG2PrecompIterator b_prec_begin,
+                                                  InputG2PrecompIterator b_prec_end) {
+                BOOST_ASSERT(std::distance(a_begin, a_end) == std::distance(b_prec_begin, b_prec_end));
+
+                return PairingCurveType::pairing::final_exponentiation(
+                    detail::miller_loop_product<PairingCurveType>(a_begin, a_end, b_prec_begin));
+            }
+
+            /**
+             * Pairing inner product prod_i e(A_i, B_i) of A in G1^n and B in G2^n, computed as a product of
+             * Miller loops followed by a single final exponentiation. With thread_count != 1 the pairs are
+             * split into blocks whose G2 precomputations and Miller loops run concurrently
+             * (0 meaning one thread per hardware thread).
+             */
+            template<typename PairingCurveType, typename InputG1Iterator, typename InputG2Iterator>
+            typename PairingCurveType::pairing::gt_type::value_type
+                pairing_inner_product(InputG1Iterator a_begin, InputG1Iterator a_end, InputG2Iterator b_begin,
+                                      InputG2Iterator b_end, std::size_t thread_count = 1) {
+                const std::size_t size = std::distance(a_begin, a_end);
+                BOOST_ASSERT(size == std::size_t(std::distance(b_begin, b_end)));
+
+                return PairingCurveType::pairing::final_exponentiation(
+                    detail::parallel_miller_loop_product<PairingCurveType>(
+                        a_begin, b_begin, size, thread_count, detail::shared_precompute_g2<PairingCurveType>()));
             }
         }    // namespace algebra
     }        // namespace crypto3
@@ -27,12 +27,21 @@
 #ifndef CRYPTO3_ALGEBRA_MULTIEXP_HPP
 #define CRYPTO3_ALGEBRA_MULTIEXP_HPP
 
+#include <cmath>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#include <boost/align/aligned_allocator.hpp>
+
 #include <nil/crypto3/multiprecision/number.hpp>
 #include <nil/crypto3/multiprecision/cpp_int.hpp>
 
+#include <nil/crypto3/detail/parallel.hpp>
+
+#include <nil/crypto3/algebra/multiexp/detail/digits.hpp>
 #include <nil/crypto3/algebra/multiexp/policies.hpp>
+#include <nil/crypto3/algebra/multiexp/tuning.hpp>
 #include <nil/crypto3/algebra/curves/params.hpp>
 
 namespace nil {
@@ -108,6 +117,86 @@ namespace nil {
                 return acc + multiexp<method_type>(g.begin(), g.end(), p.begin(), p.end(), chunks_count);
             }
 
+            /**
+             * Multi-exponentiation for witness-like scalar vectors dominated by small values (booleans,
+             * bytes, machine words). Scalars are first partitioned by bit length: zeros are dropped, ones are
+             * summed directly, scalars of at most 8, 16, 32 and 64 bits each go through multiexp_method_BDLO12
+             * restricted to their own width, so that a few wide scalars no longer force full-width windows on
+             * all others, and only the remaining full-width scalars go through MultiexpMethod.
+             */
+            template<typename MultiexpMethod, typename InputBaseIterator, typename InputFieldIterator>
+            typename std::iterator_traits<InputBaseIterator>::value_type
+                multiexp_with_scalar_partitioning(InputBaseIterator vec_start, InputBaseIterator vec_end,
+                                                  InputFieldIterator scalar_start, InputFieldIterator scalar_end,
+                                                  const std::size_t chunks_count) {
+
+                typedef typename std::iterator_traits<InputBaseIterator>::value_type base_value_type;
+                typedef typename std::iterator_traits<InputFieldIterator>::value_type field_value_type;
+                typedef typename field_value_type::modulus_type modulus_type;
+
+                BOOST_ASSERT(std::distance(vec_start, vec_end) == std::distance(scalar_start, scalar_end));
+
+                constexpr std::size_t classes_count = 4;
+                constexpr std::size_t class_bits[classes_count] = {8, 16, 32, 64};
+
+                std::vector<base_value_type> small_bases[classes_count];
+                std::vector<field_value_type> small_scalars[classes_count];
+                std::vector<base_value_type> wide_bases;
+                std::vector<field_value_type> wide_scalars;
+
+                base_value_type acc = base_value_type::zero();
+
+                InputBaseIterator vec_it = vec_start;
+                for (InputFieldIterator scalar_it = scalar_start; scalar_it != scalar_end; ++scalar_it, ++vec_it) {
+                    const modulus_type scalar = scalar_it->data.template convert_to<modulus_type>();
+                    if (scalar.is_zero()) {
+                        continue;
+                    }
+
+                    const std::size_t bits = multiprecision::msb(scalar) + 1;
+                    if (bits == 1) {
+                        acc = acc + (*vec_it);
+                        continue;
+                    }
+
+                    std::size_t class_index = 0;
+                    while (class_index < classes_count && bits > class_bits[class_index]) {
+                        ++class_index;
+                    }
+
+                    if (class_index < classes_count) {
+                        small_bases[class_index].emplace_back(*vec_it);
+                        small_scalars[class_index].emplace_back(*scalar_it);
+                    } else {
+                        wide_bases.emplace_back(*vec_it);
+                        wide_scalars.emplace_back(*scalar_it);
+                    }
+                }
+
+                for (std::size_t class_index = 0; class_index < classes_count; ++class_index) {
+                    const std::size_t length = small_bases[class_index].size();
+                    if (length == 0) {
+                        continue;
+                    }
+
+                    // the BDLO12 estimate, but never wider than the scalars themselves
+                    const std::size_t log2_length = length > 1 ? std::log2(length) : 1;
+                    const std::size_t c = std::min<std::size_t>(
+                        class_bits[class_index], std::max<std::size_t>(1, log2_length - (log2_length / 3 - 2)));
+
+                    acc = acc + policies::multiexp_method_BDLO12::process(
+                                    small_bases[class_index].cbegin(), small_bases[class_index].cend(),
+                                    small_scalars[class_index].cbegin(), small_scalars[class_index].cend(), c);
+                }
+
+                if (!wide_bases.empty()) {
+                    acc = acc + multiexp<MultiexpMethod>(wide_bases.cbegin(), wide_bases.cend(),
+                                                         wide_scalars.cbegin(), wide_scalars.cend(), chunks_count);
+                }
+
+                return acc;
+            }
+
             /**
              * A window table stores window sizes for different instance sizes for fixed-base multi-scalar
              * multiplications.
@@ -115,8 +204,117 @@ namespace nil {
             template<typename GroupType>
             using window_table = std::vector<std::vector<typename GroupType::value_type>>;
 
+            /**
+             * Same rows as window_table, the multiples 0, g', ..., (2^w - 1) g' of the shifted base
+             * g' = 2^{outer * w} g for every window, but stored as one contiguous, cache-line aligned array. Tables
+             * built by get_flat_window_table hold points in special form, so windowed_exp reads a single row per
+             * window and uses mixed additions.
+             */
+            template<typename GroupType>
+            class flat_window_table {
+            public:
+                typedef typename GroupType::value_type value_type;
+                typedef std::vector<value_type, boost::alignment::aligned_allocator<value_type, 64>> storage_type;
+
+                flat_window_table() : outer_count(0), in_window(0) {
+                }
+
+                flat_window_table(std::size_t outer_count, std::size_t in_window) :
+                    outer_count(outer_count), in_window(in_window),
+                    elements(outer_count * in_window, value_type::zero()) {
+                }
+
+                std::size_t size() const {
+                    return outer_count;
+                }
+
+                std::size_t row_size() const {
+                    return in_window;
+                }
+
+                const value_type *operator[](std::size_t outer) const {
+                    return elements.data() + outer * in_window;
+                }
+
+                value_type *operator[](std::size_t outer) {
+                    return elements.data() + outer * in_window;
+                }
+
+                storage_type &data() {
+                    return elements;
+                }
+
+            private:
+                std::size_t outer_count;
+                std::size_t in_window;
+                storage_type elements;
+            };
+
+            namespace detail {
+                /**
+                 * Groups whose points can be brought to the special form used by mixed_add provide a static
+                 * batch_to_special_all_non_zeros. The twisted Edwards groups (JubJub, BabyJubJub) do not.
+                 */
+                template<typename GroupType, typename = void>
+                struct has_batch_to_special : std::false_type { };
+
+                template<typename GroupType>
+                struct has_batch_to_special<GroupType,
+                                            decltype(GroupType::batch_to_special_all_non_zeros(
+                                                std::declval<std::vector<typename GroupType::value_type> &>()))>
+                    : std::true_type { };
+
+                template<typename GroupType>
+                void batch_to_special_all_non_zeros(std::vector<typename GroupType::value_type> &vec,
+                                                    std::true_type) {
+                    GroupType::batch_to_special_all_non_zeros(vec);
+                }
+
+                template<typename GroupType>
+                void batch_to_special_all_non_zeros(std::vector<typename GroupType::value_type> &vec,
+                                                    std::false_type) {
+                    for (typename GroupType::value_type &p : vec) {
+                        p = p.to_affine();
+                    }
+                }
+
+                template<typename ValueType>
+                ValueType add_window_entry(const ValueType &acc, const ValueType &entry, std::true_type) {
+                    return acc.mixed_add(entry);
+                }
+
+                template<typename ValueType>
+                ValueType add_window_entry(const ValueType &acc, const ValueType &entry, std::false_type) {
+                    return acc + entry;
+                }
+
+                template<typename WindowTable>
+                std::size_t exp_window_size_from_table(const WindowTable &table, const std::size_t num_scalars) {
+                    std::size_t window = 1;
+
+                    for (std::size_t i = table.size(); i-- > 0;) {
+                        if (table[i] != 0 && num_scalars >= table[i]) {
+                            window = i + 1;
+                            break;
+                        }
+                    }
+
+                    return window;
+                }
+            }    // namespace detail
+
+            /**
+             * Picks the fixed-base window for num_scalars exponentiations. A window table from the
+             * tuning profile of the group (see multiexp/tuning.hpp) takes precedence over the compiled-in
+             * curves::multiexp_params table.
+             */
             template<typename GroupType>
             std::size_t get_exp_window_size(const std::size_t num_scalars) {
+                const multiexp_tuning_profile &profile = multiexp_tuning<GroupType>::profile();
+                if (!profile.fixed_base_exp_window_table.empty()) {
+                    return detail::exp_window_size_from_table(profile.fixed_base_exp_window_table, num_scalars);
+                }
+
                 if (curves::multiexp_params<GroupType>::fixed_base_exp_window_table.empty()) {
 #ifdef LOWMEM
                     return 14;
@@ -125,16 +323,8 @@ namespace nil {
 #endif
                 }
 
-                std::size_t window = 1;
-
-                for (std::size_t i = curves::multiexp_params<GroupType>::fixed_base_exp_window_table.size() - 1; i >= 0;
-                     --i) {
-                    if (curves::multiexp_params<GroupType>::fixed_base_exp_window_table[i] != 0 &&
-                        num_scalars >= curves::multiexp_params<GroupType>::fixed_base_exp_window_table[i]) {
-                        window = i + 1;
-                        break;
-                    }
-                }
+                std::size_t window = detail::exp_window_size_from_table(
+                    curves::multiexp_params<GroupType>::fixed_base_exp_window_table, num_scalars);
 
 #ifdef LOWMEM
                 window = std::min((std::size_t)14, window);
@@ -142,16 +332,58 @@ namespace nil {
                 return window;
             }
 
+            template<typename GroupType, typename InputRange>
+            typename std::enable_if<
+                std::is_same<typename InputRange::value_type, typename GroupType::value_type>::value, void>::type
+                batch_to_special(InputRange &vec) {
+
+                std::vector<typename GroupType::value_type> non_zero_vec;
+                for (std::size_t i = 0; i < vec.size(); ++i) {
+                    if (!vec[i].is_zero()) {
+                        non_zero_vec.emplace_back(vec[i]);
+                    }
+                }
+
+                detail::batch_to_special_all_non_zeros<GroupType>(non_zero_vec,
+                                                                  detail::has_batch_to_special<GroupType>());
+                typename std::vector<typename GroupType::value_type>::const_iterator it = non_zero_vec.begin();
+                typename GroupType::value_type zero_special = GroupType::value_type::zero().to_projective();
+
+                for (std::size_t i = 0; i < vec.size(); ++i) {
+                    if (!vec[i].is_zero()) {
+                        vec[i] = *it;
+                        ++it;
+                    } else {
+                        vec[i] = zero_special;
+                    }
+                }
+            }
+
+            namespace detail {
+                template<typename GroupType>
+                void normalize_window_table(flat_window_table<GroupType> &table, std::true_type) {
+                    // one inversion for the whole table instead of one per element
+                    batch_to_special<GroupType>(table.data());
+                }
+
+                template<typename GroupType>
+                void normalize_window_table(flat_window_table<GroupType> &, std::false_type) {
+                }
+            }    // namespace detail
+
+            /**
+             * Builds the flat table of g for windowed_exp. For groups with batch_to_special_all_non_zeros the
+             * whole table is brought to the special form with one field inversion.
+             */
             template<typename GroupType>
-            window_table<GroupType> get_window_table(const std::size_t scalar_size,
-                                                     const std::size_t window,
-                                                     const typename GroupType::value_type &g) {
+            flat_window_table<GroupType> get_flat_window_table(const std::size_t scalar_size,
+                                                               const std::size_t window,
+                                                               const typename GroupType::value_type &g) {
                 const std::size_t in_window = 1ul << window;
                 const std::size_t outerc = (scalar_size + window - 1) / window;
                 const std::size_t last_in_window = 1ul << (scalar_size - (outerc - 1) * window);
 
-                window_table<GroupType> powers_of_g(
-                    outerc, std::vector<typename GroupType::value_type>(in_window, GroupType::value_type::zero()));
+                flat_window_table<GroupType> powers_of_g(outerc, in_window);
 
                 typename GroupType::value_type gouter = g;
 
@@ -168,95 +400,98 @@ namespace nil {
                     }
                 }
 
+                detail::normalize_window_table(powers_of_g, detail::has_batch_to_special<GroupType>());
+
                 return powers_of_g;
             }
 
-            //
-            template<typename GroupType, typename FieldType>
+            template<typename GroupType>
+            window_table<GroupType> get_window_table(const std::size_t scalar_size,
+                                                     const std::size_t window,
+                                                     const typename GroupType::value_type &g) {
+                const flat_window_table<GroupType> flat = get_flat_window_table<GroupType>(scalar_size, window, g);
+
+                window_table<GroupType> powers_of_g(flat.size());
+                for (std::size_t outer = 0; outer < flat.size(); ++outer) {
+                    powers_of_g[outer].assign(flat[outer], flat[outer] + flat.row_size());
+                }
+
+                return powers_of_g;
+            }
+
+            /**
+             * @param powers_of_g either a window_table or a flat_window_table of the base. Only flat tables are
+             * assumed to be in special form and use mixed additions, a window_table may have been filled by the
+             * caller.
+             */
+            template<typename GroupType, typename FieldType, typename WindowTable>
             typename GroupType::value_type windowed_exp(const std::size_t scalar_size,
                                                         const std::size_t window,
-                                                        const window_table<GroupType> &powers_of_g,
+                                                        const WindowTable &powers_of_g,
                                                         const typename FieldType::value_type &pow) {
 
-                typedef typename FieldType::number_type number_type;
+                typedef typename FieldType::modulus_type modulus_type;
+                typedef std::integral_constant<bool,
+                                               std::is_same<WindowTable, flat_window_table<GroupType>>::value &&
+                                                   detail::has_batch_to_special<GroupType>::value>
+                    use_mixed_add;
 
                 const std::size_t outerc = (scalar_size + window - 1) / window;
-                const number_type pow_val = pow.data;
+                const modulus_type pow_val = pow.data.template convert_to<modulus_type>();
                 /* exp */
                 typename GroupType::value_type res = powers_of_g[0][0];
 
                 for (std::size_t outer = 0; outer < outerc; ++outer) {
-                    std::size_t inner = 0;
-                    for (std::size_t i = 0; i < window; ++i) {
-                        if (multiprecision::bit_test(pow_val, outer * window + i)) {
-                            inner |= 1u << i;
-                        }
-                    }
+                    const std::size_t inner = detail::get_window(pow_val, outer * window, window);
 
-                    res = res + powers_of_g[outer][inner];
+                    res = detail::add_window_entry(res, powers_of_g[outer][inner], use_mixed_add());
                 }
 
                 return res;
             }
 
-            template<typename GroupType, typename FieldType, typename InputRange,
+            /**
+             * Fixed-base exponentiation of every scalar of v, split over thread_count threads
+             * (0 meaning one per hardware thread).
+             */
+            template<typename GroupType, typename FieldType, typename InputRange, typename WindowTable,
                      typename = typename std::enable_if<
                          std::is_same<typename InputRange::value_type, typename FieldType::value_type>::value>::type>
             std::vector<typename GroupType::value_type> batch_exp(const std::size_t scalar_size,
                                                                   const std::size_t window,
-                                                                  const window_table<GroupType> &table,
-                                                                  const InputRange &v) {
+                                                                  const WindowTable &table,
+                                                                  const InputRange &v,
+                                                                  const std::size_t thread_count = 1) {
                 std::vector<typename GroupType::value_type> res(std::distance(v.begin(), v.end()), table[0][0]);
 
-                for (std::size_t i = 0; i < v.size(); ++i) {
-                    res[i] = windowed_exp<GroupType, FieldType>(scalar_size, window, table, v[i]);
-                }
+                nil::crypto3::detail::parallel_for(res.size(), thread_count, [&](std::size_t begin, std::size_t end) {
+                    for (std::size_t i = begin; i < end; ++i) {
+                        res[i] = windowed_exp<GroupType, FieldType>(scalar_size, window, table, v[i]);
+                    }
+                });
 
                 return res;
             }
 
-            template<typename GroupType, typename FieldType, typename InputRange,
+            template<typename GroupType, typename FieldType, typename InputRange, typename WindowTable,
                      typename = typename std::enable_if<
                          std::is_same<typename InputRange::value_type, typename FieldType::value_type>::value>::type>
             std::vector<typename GroupType::value_type>
                 batch_exp_with_coeff(const std::size_t scalar_size,
                                      const std::size_t window,
-                                     const window_table<GroupType> &table,
+                                     const WindowTable &table,
                                      const typename FieldType::value_type &coeff,
-                                     const InputRange &v) {
+                                     const InputRange &v,
+                                     const std::size_t thread_count = 1) {
                 std::vector<typename GroupType::value_type> res(std::distance(v.begin(), v.end()), table[0][0]);
 
-                for (std::size_t i = 0; i < v.size(); ++i) {
-                    res[i] = windowed_exp<GroupType, FieldType>(scalar_size, window, table, coeff * v[i]);
-                }
-
-                return res;
-            }
-
-            template<typename GroupType, typename InputRange>
-            typename std::enable_if<
-                std::is_same<typename InputRange::value_type, typename GroupType::value_type>::value, void>::type
-                batch_to_special(InputRange &vec) {
-
-                std::vector<typename GroupType::value_type> non_zero_vec;
-                for (std::size_t i = 0; i < vec.size(); ++i) {
-                    if (!vec[i].is_zero()) {
-                        non_zero_vec.emplace_back(vec[i]);
+                nil::crypto3::detail::parallel_for(res.size(), thread_count, [&](std::size_t begin, std::size_t end) {
+                    for (std::size_t i = begin; i < end; ++i) {
+                        res[i] = windowed_exp<GroupType, FieldType>(scalar_size, window, table, coeff * v[i]);
                     }
-                }
-
-                GroupType::batch_to_special_all_non_zeros(non_zero_vec);
-                typename std::vector<typename GroupType::value_type>::const_iterator it = non_zero_vec.begin();
-                typename GroupType::value_type zero_special = GroupType::value_type::zero().to_projective();
+                });
 
-                for (std::size_t i = 0; i < vec.size(); ++i) {
-                    if (!vec[i].is_zero()) {
-                        vec[i] = *it;
-                        ++it;
-                    } else {
-                        vec[i] = zero_special;
-                    }
-                }
+                return res;
             }
         }    // namespace algebra
     }        // namespace crypto3
@@ -27,31 +27,157 @@
 #ifndef CRYPTO3_ALGEBRA_MULTIEXP_BASIC_POLICIES_HPP
 #define CRYPTO3_ALGEBRA_MULTIEXP_BASIC_POLICIES_HPP
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <vector>
 
 #include <nil/crypto3/multiprecision/number.hpp>
 #include <nil/crypto3/multiprecision/cpp_int.hpp>
 
 #include <nil/crypto3/algebra/wnaf.hpp>
+#include <nil/crypto3/algebra/curves/params.hpp>
+#include <nil/crypto3/algebra/multiexp/detail/digits.hpp>
+#include <nil/crypto3/algebra/multiexp/tuning.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace algebra {
             namespace policies {
                 namespace detail {
+                    /**
+                     * Max-heap of exponent indices for the Bos-Coster method. The exponents are fixed-width
+                     * integers kept in a flat array together with their cached bit lengths, so that ordering
+                     * compares lengths first and the heap only ever moves indices.
+                     */
                     template<typename NumberType>
-                    class ordered_exponent {
-                        using number_type = NumberType;
-
+                    class bos_coster_heap {
                     public:
-                        std::size_t idx;
-                        number_type r;
-                        using r_type = number_type;
+                        typedef NumberType number_type;
+
+                        explicit bos_coster_heap(std::size_t size) : r(size), bits(size, 0), heap(size) {
+                            for (std::size_t i = 0; i < size; ++i) {
+                                heap[i] = i;
+                            }
+                        }
+
+                        void set(std::size_t idx, const number_type &value) {
+                            r[idx] = value;
+                            bits[idx] = value.is_zero() ? 0 : multiprecision::msb(value) + 1;
+                        }
+
+                        bool less(std::size_t i, std::size_t j) const {
+                            return bits[i] != bits[j] ? bits[i] < bits[j] : r[i] < r[j];
+                        }
+
+                        void make_heap() {
+                            for (std::size_t pos = heap.size() / 2; pos-- > 0;) {
+                                sift_down(pos);
+                            }
+                        }
+
+                        /**
+                         * Restores the heap after the top exponent was decreased. The top is first sunk to a
+                         * leaf along the path of larger children and then lifted back, which needs fewer
+                         * comparisons than a plain sift-down as the decreased value usually ends up deep.
+                         */
+                        void top_decreased() {
+                            const std::size_t n = heap.size();
+                            std::size_t pos = 0;
+                            while (2 * pos + 2 < n) {
+                                const std::size_t child =
+                                    less(heap[2 * pos + 1], heap[2 * pos + 2]) ? 2 * pos + 2 : 2 * pos + 1;
+                                std::swap(heap[pos], heap[child]);
+                                pos = child;
+                            }
+                            if (2 * pos + 1 < n) {
+                                std::swap(heap[pos], heap[2 * pos + 1]);
+                                pos = 2 * pos + 1;
+                            }
+
+                            while (pos > 0 && less(heap[(pos - 1) / 2], heap[pos])) {
+                                std::swap(heap[pos], heap[(pos - 1) / 2]);
+                                pos = (pos - 1) / 2;
+                            }
+                        }
+
+                        std::size_t top() const {
+                            return heap[0];
+                        }
+
+                        // the larger of the two children of the top
+                        std::size_t second() const {
+                            if (heap.size() < 3) {
+                                return heap[1];
+                            }
+                            return less(heap[1], heap[2]) ? heap[2] : heap[1];
+                        }
+
+                        std::vector<number_type> r;
+                        std::vector<std::size_t> bits;
+
+                    private:
+                        void sift_down(std::size_t pos) {
+                            const std::size_t n = heap.size();
+                            while (2 * pos + 1 < n) {
+                                std::size_t child = 2 * pos + 1;
+                                if (child + 1 < n && less(heap[child], heap[child + 1])) {
+                                    ++child;
+                                }
+                                if (!less(heap[pos], heap[child])) {
+                                    break;
+                                }
+                                std::swap(heap[pos], heap[child]);
+                                pos = child;
+                            }
+                        }
 
-                        ordered_exponent(const std::size_t idx, const number_type &r) : idx(idx), r(r) {};
+                        std::vector<std::size_t> heap;
+                    };
+
+                    /**
+                     * Splits a scalar k into k1 + k2 * lambda (mod r) with |k1|, |k2| below
+                     * 2^decomposition_bits, using the lattice basis and rounding constants of
+                     * curves::glv_params<GroupType>. Halves are returned as magnitudes and signs.
+                     */
+                    template<typename GroupType>
+                    struct glv_decomposition {
+                        typedef curves::glv_params<GroupType> params_type;
+                        typedef typename params_type::modulus_type modulus_type;
+
+                        constexpr static const std::size_t wide_bits =
+                            2 * GroupType::curve_type::scalar_field_type::modulus_bits;
+                        typedef multiprecision::number<multiprecision::backends::cpp_int_backend<
+                            wide_bits, wide_bits, multiprecision::unsigned_magnitude, multiprecision::unchecked, void>>
+                            wide_type;
+
+                        static void process(const modulus_type &k, modulus_type *halves, bool *negative) {
+                            const wide_type scalar(k);
+                            const wide_type half = wide_type(1) << (params_type::rounding_shift - 1);
+
+                            const wide_type c1 = (scalar * wide_type(params_type::b2_over_r) + half) >>
+                                                 params_type::rounding_shift;
+                            const wide_type c2 = (scalar * wide_type(params_type::minus_b1_over_r) + half) >>
+                                                 params_type::rounding_shift;
+
+                            // k1 = k - c1 * a1 - c2 * a2, k2 = c1 * minus_b1 - c2 * b2
+                            signed_difference(scalar, c1 * wide_type(params_type::a1) + c2 * wide_type(params_type::a2),
+                                              halves[0], negative[0]);
+                            signed_difference(c1 * wide_type(params_type::minus_b1), c2 * wide_type(params_type::b2),
+                                              halves[1], negative[1]);
+
+                            BOOST_ASSERT(halves[0].is_zero() ||
+                                         multiprecision::msb(halves[0]) < params_type::decomposition_bits);
+                            BOOST_ASSERT(halves[1].is_zero() ||
+                                         multiprecision::msb(halves[1]) < params_type::decomposition_bits);
+                        }
 
-                        bool operator<(const ordered_exponent &other) const {
-                            return (this->r < other.r);
+                    private:
+                        static void signed_difference(const wide_type &x, const wide_type &y, modulus_type &magnitude,
+                                                      bool &negative) {
+                            negative = x < y;
+                            const wide_type difference = negative ? wide_type(y - x) : wide_type(x - y);
+                            magnitude = difference.template convert_to<modulus_type>();
                         }
                     };
                 }    // namespace detail
@@ -105,6 +231,24 @@ namespace nil {
                                 InputFieldIterator exponents,
                                 InputFieldIterator exponents_end) {
 
+                        // empirically, this seems to be a decent estimate of the optimal value of c
+                        std::size_t log2_length = std::log2(std::distance(bases, bases_end));
+                        std::size_t c = log2_length - (log2_length / 3 - 2);
+
+                        return process(bases, bases_end, exponents, exponents_end, c);
+                    }
+
+                    /**
+                     * Same as above with an explicit window width c, e.g. taken from a tuning profile.
+                     */
+                    template<typename InputBaseIterator, typename InputFieldIterator>
+                    static inline typename std::iterator_traits<InputBaseIterator>::value_type
+                        process(InputBaseIterator bases,
+                                InputBaseIterator bases_end,
+                                InputFieldIterator exponents,
+                                InputFieldIterator exponents_end,
+                                std::size_t c) {
+
                         typedef typename std::iterator_traits<InputBaseIterator>::value_type base_value_type;
                         typedef typename std::iterator_traits<InputFieldIterator>::value_type field_value_type;
 
@@ -112,12 +256,10 @@ namespace nil {
                         std::size_t scalars_length = std::distance(exponents, exponents_end);
 
                         assert (length == scalars_length);
-
-                        // empirically, this seems to be a decent estimate of the optimal value of c
-                        std::size_t log2_length = std::log2(length);
-                        std::size_t c = log2_length - (log2_length / 3 - 2);
+                        assert (c > 0);
 
                         std::size_t num_bits = 0;
+                        std::vector<std::size_t> exponents_bits(length);
 
                         for (std::size_t i = 0; i < length; i++) {
                             // Should be
@@ -127,6 +269,7 @@ namespace nil {
                             if (exponents[i].data != 0){
                                 bn_exponents_i_msb = multiprecision::msb(exponents[i].data) + 1;
                             }
+                            exponents_bits[i] = bn_exponents_i_msb;
                             num_bits = std::max(num_bits, bn_exponents_i_msb);
                         }
 
@@ -146,6 +289,11 @@ namespace nil {
                             std::vector<bool> bucket_nonzero(1 << c);
 
                             for (std::size_t i = 0; i < length; i++) {
+                                // short exponents have no bits in the upper groups
+                                if (exponents_bits[i] <= k * c) {
+                                    continue;
+                                }
+
                                 std::size_t id = 0;
                                 for (std::size_t j = 0; j < c; j++) {
                                     if (multiprecision::bit_test(exponents[i].data, k * c + j)) {
@@ -222,10 +370,7 @@ namespace nil {
 
                         typedef typename std::iterator_traits<InputBaseIterator>::value_type base_value_type;
                         typedef typename std::iterator_traits<InputFieldIterator>::value_type field_value_type;
-
-                        // temporary added until fixed-precision modular adaptor is ready:
-                        typedef multiprecision::number<multiprecision::backends::cpp_int_backend<>>
-                            non_fixed_precision_number_type;
+                        typedef typename field_value_type::modulus_type modulus_type;
 
                         if (vec_start == vec_end) {
                             return base_value_type::zero();
@@ -235,13 +380,12 @@ namespace nil {
                             return (*scalar_start) * (*vec_start);
                         }
 
-                        std::vector<detail::ordered_exponent<non_fixed_precision_number_type>> opt_q;
                         const std::size_t vec_len = scalar_end - scalar_start;
-                        const std::size_t odd_vec_len = (vec_len % 2 == 1 ? vec_len : vec_len + 1);
-                        opt_q.reserve(odd_vec_len);
+
+                        detail::bos_coster_heap<modulus_type> opt_q(vec_len);
 
                         std::vector<base_value_type> g;
-                        g.reserve(odd_vec_len);
+                        g.reserve(vec_len);
 
                         InputBaseIterator vec_it;
                         InputFieldIterator scalar_it;
@@ -249,39 +393,31 @@ namespace nil {
                         for (i = 0, vec_it = vec_start, scalar_it = scalar_start; vec_it != vec_end;
                              ++vec_it, ++scalar_it, ++i) {
                             g.emplace_back(*vec_it);
-
-                            opt_q.emplace_back(detail::ordered_exponent<non_fixed_precision_number_type>(
-                                i, non_fixed_precision_number_type(scalar_it->data)));
+                            opt_q.set(i, scalar_it->data.template convert_to<modulus_type>());
                         }
 
-                        std::make_heap(opt_q.begin(), opt_q.end());
-
-                        assert(scalar_it == scalar_end);
+                        BOOST_ASSERT(scalar_it == scalar_end);
 
-                        if (vec_len != odd_vec_len) {
-                            g.emplace_back(base_value_type::zero());
-                            opt_q.emplace_back(
-                                detail::ordered_exponent<non_fixed_precision_number_type>(odd_vec_len - 1, 0ul));
-                        }
-                        assert(g.size() % 2 == 1);
-                        assert(opt_q.size() == g.size());
+                        opt_q.make_heap();
 
                         base_value_type opt_result = base_value_type::zero();
 
                         while (true) {
-                            detail::ordered_exponent<non_fixed_precision_number_type> &a = opt_q[0];
-                            detail::ordered_exponent<non_fixed_precision_number_type> &b =
-                                (opt_q[1] < opt_q[2] ? opt_q[2] : opt_q[1]);
+                            const std::size_t a = opt_q.top();
+                            const std::size_t b = opt_q.second();
 
-                            const std::size_t abits = multiprecision::msb(a.r) + 1;
+                            const std::size_t abits = opt_q.bits[a];
 
-                            if (b.r.is_zero()) {
-                                // opt_result = opt_result + (a.r * g[a.idx]);
-                                opt_result = opt_result + opt_window_wnaf_exp(g[a.idx], a.r, abits);
+                            if (abits == 0) {
                                 break;
                             }
 
-                            const std::size_t bbits = multiprecision::msb(b.r) + 1;
+                            if (opt_q.bits[b] == 0) {
+                                opt_result = opt_result + opt_window_wnaf_exp(g[a], opt_q.r[a], abits);
+                                break;
+                            }
+
+                            const std::size_t bbits = opt_q.bits[b];
                             const std::size_t limit = (abits - bbits >= 20 ? 20 : abits - bbits);
 
                             if (bbits < 1ul << limit) {
@@ -289,39 +425,167 @@ namespace nil {
                                   In this case, exponentiating to the power of a is cheaper than
                                   subtracting b from a multiple times, so let's do it directly
                                 */
-                                // opt_result = opt_result + (a.r * g[a.idx]);
-                                opt_result = opt_result + opt_window_wnaf_exp(g[a.idx], a.r, abits);
+                                opt_result = opt_result + opt_window_wnaf_exp(g[a], opt_q.r[a], abits);
 
-                                a.r = 0;
+                                opt_q.set(a, modulus_type(0));
                             } else {
                                 // x A + y B => (x-y) A + y (B+A)
-                                a.r = a.r - b.r;
-                                g[b.idx] = g[b.idx] + g[a.idx];
+                                opt_q.set(a, opt_q.r[a] - opt_q.r[b]);
+                                g[b] = g[b] + g[a];
+                            }
+
+                            // regardless of whether a was cleared or subtracted from, it is no longer the maximum
+                            opt_q.top_decreased();
+                        }
+
+                        return opt_result;
+                    }
+                };
+
+                /**
+                 * Pippenger's method over the GLV split of the instance: every scalar k_i is decomposed as
+                 * k_i = k_i1 + k_i2 * lambda with half-width k_i1, k_i2, and the bases list is extended with
+                 * phi(P_i) = lambda * P_i, so the 2N-point instance has half as many windows. Window digits are
+                 * signed, negative digits adding the negated base.
+                 * Requires curves::glv_params<GroupType> (curves/params/glv) for the group of the bases,
+                 * i.e. G1 of BLS12-381, BLS12-377 or alt_bn128.
+                 */
+                struct multiexp_method_glv {
+                    template<typename InputBaseIterator, typename InputFieldIterator>
+                    static inline typename std::iterator_traits<InputBaseIterator>::value_type
+                        process(InputBaseIterator bases,
+                                InputBaseIterator bases_end,
+                                InputFieldIterator exponents,
+                                InputFieldIterator exponents_end) {
+
+                        // the estimate of multiexp_method_BDLO12, applied to the doubled instance
+                        const std::size_t log2_length = std::log2(2 * std::distance(bases, bases_end));
+                        const std::size_t c = log2_length + 2 - log2_length / 3;
+
+                        return process(bases, bases_end, exponents, exponents_end, c);
+                    }
+
+                    template<typename InputBaseIterator, typename InputFieldIterator>
+                    static inline typename std::iterator_traits<InputBaseIterator>::value_type
+                        process(InputBaseIterator bases,
+                                InputBaseIterator bases_end,
+                                InputFieldIterator exponents,
+                                InputFieldIterator exponents_end,
+                                std::size_t c) {
+
+                        typedef typename std::iterator_traits<InputBaseIterator>::value_type base_value_type;
+                        typedef typename base_value_type::group_type group_type;
+                        typedef detail::glv_decomposition<group_type> decomposition_type;
+                        typedef typename decomposition_type::params_type params_type;
+                        typedef typename decomposition_type::modulus_type modulus_type;
+
+                        const std::size_t length = std::distance(bases, bases_end);
+
+                        BOOST_ASSERT(length == std::size_t(std::distance(exponents, exponents_end)));
+                        BOOST_ASSERT(c > 1 && c < 32);
+
+                        const std::size_t windows = detail::signed_windows_count(params_type::decomposition_bits, c);
+
+                        // split bases P_0, phi(P_0), P_1, phi(P_1), ... with the signs of the halves applied
+                        std::vector<base_value_type> split_bases;
+                        split_bases.reserve(2 * length);
+                        std::vector<std::int64_t> digits(2 * length * windows);
+
+                        modulus_type halves[2];
+                        bool negative[2];
+                        for (std::size_t i = 0; i < length; ++i, ++bases, ++exponents) {
+                            decomposition_type::process(exponents->data.template convert_to<modulus_type>(), halves,
+                                                        negative);
+
+                            const base_value_type phi(params_type::beta * bases->X, bases->Y, bases->Z);
+                            split_bases.emplace_back(negative[0] ? -(*bases) : *bases);
+                            split_bases.emplace_back(negative[1] ? -phi : phi);
+
+                            detail::signed_window_digits(halves[0], c, windows, &digits[2 * i * windows]);
+                            detail::signed_window_digits(halves[1], c, windows, &digits[(2 * i + 1) * windows]);
+                        }
+
+                        const std::size_t buckets_count = std::size_t(1) << (c - 1);
+                        std::vector<base_value_type> buckets(buckets_count);
+                        std::vector<bool> bucket_nonzero(buckets_count);
+
+                        base_value_type result = base_value_type::zero();
+
+                        for (std::size_t k = windows; k-- > 0;) {
+                            for (std::size_t i = 0; i < c; i++) {
+                                result = result.doubled();
                             }
 
-                            // regardless of whether a was cleared or subtracted from we push it down, then take back up
+                            std::fill(bucket_nonzero.begin(), bucket_nonzero.end(), false);
+
+                            for (std::size_t j = 0; j < split_bases.size(); ++j) {
+                                const std::int64_t digit = digits[j * windows + k];
+                                if (digit == 0) {
+                                    continue;
+                                }
+
+                                const std::size_t id = (digit > 0 ? digit : -digit) - 1;
+                                const base_value_type addend = digit > 0 ? split_bases[j] : -split_bases[j];
 
-                            /* heapify A down */
-                            std::size_t a_pos = 0;
-                            while (2 * a_pos + 2 < odd_vec_len) {
-                                // this is a max-heap so to maintain a heap property we swap with the largest of the two
-                                if (opt_q[2 * a_pos + 1] < opt_q[2 * a_pos + 2]) {
-                                    std::swap(opt_q[a_pos], opt_q[2 * a_pos + 2]);
-                                    a_pos = 2 * a_pos + 2;
+                                if (bucket_nonzero[id]) {
+                                    buckets[id] = buckets[id] + addend;
                                 } else {
-                                    std::swap(opt_q[a_pos], opt_q[2 * a_pos + 1]);
-                                    a_pos = 2 * a_pos + 1;
+                                    buckets[id] = addend;
+                                    bucket_nonzero[id] = true;
                                 }
                             }
 
-                            /* now heapify A up appropriate amount of times */
-                            while (a_pos > 0 && opt_q[(a_pos - 1) / 2] < opt_q[a_pos]) {
-                                std::swap(opt_q[a_pos], opt_q[(a_pos - 1) / 2]);
-                                a_pos = (a_pos - 1) / 2;
+                            base_value_type running_sum = base_value_type::zero();
+                            base_value_type window_sum = base_value_type::zero();
+
+                            for (std::size_t id = buckets_count; id-- > 0;) {
+                                if (bucket_nonzero[id]) {
+                                    running_sum = running_sum + buckets[id];
+                                }
+                                window_sum = window_sum + running_sum;
                             }
+
+                            result = result + window_sum;
                         }
 
-                        return opt_result;
+                        return result;
+                    }
+                };
+
+                /**
+                 * Dispatches every instance to the method and window that the tuning profile of the group
+                 * (see multiexp/tuning.hpp) selected for its size on this host. Falls back to
+                 * multiexp_method_BDLO12 with its default window when no profile is installed.
+                 */
+                struct multiexp_method_tuned {
+                    template<typename InputBaseIterator, typename InputFieldIterator>
+                    static inline typename std::iterator_traits<InputBaseIterator>::value_type
+                        process(InputBaseIterator bases,
+                                InputBaseIterator bases_end,
+                                InputFieldIterator exponents,
+                                InputFieldIterator exponents_end) {
+
+                        typedef typename std::iterator_traits<InputBaseIterator>::value_type base_value_type;
+                        typedef typename base_value_type::group_type group_type;
+
+                        const multiexp_tuning_range *range =
+                            multiexp_tuning<group_type>::profile().find(std::distance(bases, bases_end));
+
+                        if (range == nullptr) {
+                            return multiexp_method_BDLO12::process(bases, bases_end, exponents, exponents_end);
+                        }
+
+                        switch (range->method) {
+                            case multiexp_method_type::naive_plain:
+                                return multiexp_method_naive_plain::process(bases, bases_end, exponents,
+                                                                            exponents_end);
+                            case multiexp_method_type::bos_coster:
+                                return multiexp_method_bos_coster::process(bases, bases_end, exponents,
+                                                                           exponents_end);
+                            default:
+                                return multiexp_method_BDLO12::process(bases, bases_end, exponents, exponents_end,
+                                                                       range->window);
+                        }
                     }
                 };
             }    // namespace policies
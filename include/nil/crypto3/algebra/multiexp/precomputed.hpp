@@ -0,0 +1,331 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_MULTIEXP_PRECOMPUTED_HPP
+#define CRYPTO3_ALGEBRA_MULTIEXP_PRECOMPUTED_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/algebra/multiexp/multiexp.hpp>
+#include <nil/crypto3/algebra/multiexp/detail/digits.hpp>
+#include <nil/crypto3/algebra/multiexp/detail/point_codec.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+
+            /**
+             * Multi-scalar multiplication against a fixed vector of bases.
+             *
+             * For every base P_i the object stores affine copies 2^{j s c} P_i, where c is the window width
+             * and s is the stride. With s = 1 every window of every scalar has its own copy of the base, so
+             * a multi-exponentiation becomes a single bucket pass made of mixed additions only and no
+             * doublings at all. A memory budget bounds the number of stored copies: when it is too small to
+             * hold a copy per window, only every s-th window gets one and the remaining windows are merged
+             * back with (s - 1) c doublings at the end.
+             *
+             * The table has a stable byte representation (see to_bytes() and from_bytes()) so that it can be
+             * computed once per proving key, stored on disk and loaded from a read-only mapping of that file
+             * by every prover process.
+             */
+            template<typename GroupType, typename FieldType = typename GroupType::curve_type::scalar_field_type>
+            class multiexp_precomputed {
+                typedef detail::affine_point_codec<GroupType> point_codec;
+
+            public:
+                typedef GroupType group_type;
+                typedef FieldType field_type;
+                typedef typename group_type::value_type value_type;
+                typedef typename field_type::value_type field_value_type;
+                typedef typename field_type::modulus_type modulus_type;
+
+                typedef std::uint8_t chunk_type;
+
+                constexpr static const std::uint32_t format_version = 2;
+                constexpr static const std::size_t header_octets_num = 4 + 4 + 5 * 8;
+                constexpr static const std::size_t point_octets_num = point_codec::octets_num;
+
+                multiexp_precomputed() : bases_count(0), c(1), stride(1), rows(0) {
+                }
+
+                /**
+                 * @param window the window width c; 0 selects the same estimate as multiexp_method_BDLO12
+                 * @param memory_budget the upper bound, in bytes, on the memory taken by the stored copies
+                 */
+                template<typename InputBaseIterator>
+                multiexp_precomputed(InputBaseIterator bases_first, InputBaseIterator bases_last,
+                                     std::size_t window = 0,
+                                     std::size_t memory_budget = std::numeric_limits<std::size_t>::max()) :
+                    bases_count(std::distance(bases_first, bases_last)),
+                    c(window != 0 ? window : default_window(bases_count)), stride(1), rows(0) {
+
+                    BOOST_ASSERT(c > 1 && c < 32);
+
+                    const std::size_t windows = detail::signed_windows_count(field_type::modulus_bits, c);
+                    const std::size_t copy_size = sizeof(value_type);
+
+                    // pick the smallest stride whose table fits into the budget
+                    while (stride < windows &&
+                           bases_count * ((windows + stride - 1) / stride) > memory_budget / copy_size) {
+                        ++stride;
+                    }
+                    rows = (windows + stride - 1) / stride;
+
+                    copies.reserve(bases_count * rows);
+
+                    for (InputBaseIterator it = bases_first; it != bases_last; ++it) {
+                        value_type shifted = *it;
+                        for (std::size_t j = 0; j < rows; ++j) {
+                            copies.emplace_back(shifted);
+                            if (j + 1 < rows) {
+                                for (std::size_t i = 0; i < stride * c; ++i) {
+                                    shifted = shifted.doubled();
+                                }
+                            }
+                        }
+                    }
+
+                    // bring all copies to the special form with a single field inversion
+                    batch_to_special<GroupType>(copies);
+                }
+
+                std::size_t size() const {
+                    return bases_count;
+                }
+
+                std::size_t window() const {
+                    return c;
+                }
+
+                /**
+                 * @return the number of windows sharing each stored copy, 1 meaning no doublings are needed
+                 */
+                std::size_t window_stride() const {
+                    return stride;
+                }
+
+                /**
+                 * Computes sum_i scalar_i * P_i. The scalar range may be shorter than the base vector,
+                 * in which case only the leading bases are used.
+                 */
+                template<typename InputFieldIterator>
+                value_type process(InputFieldIterator scalars_first, InputFieldIterator scalars_last) const {
+                    const std::size_t length = std::distance(scalars_first, scalars_last);
+                    BOOST_ASSERT(length <= bases_count);
+
+                    const std::size_t windows = detail::signed_windows_count(field_type::modulus_bits, c);
+                    const std::size_t buckets_count = std::size_t(1) << (c - 1);
+
+                    std::vector<value_type> buckets(stride * buckets_count, value_type::zero());
+                    std::vector<std::int64_t> digits(windows);
+
+                    InputFieldIterator scalar_it = scalars_first;
+                    for (std::size_t i = 0; i < length; ++i, ++scalar_it) {
+                        const modulus_type scalar = scalar_it->data.template convert_to<modulus_type>();
+                        if (scalar.is_zero()) {
+                            continue;
+                        }
+
+                        detail::signed_window_digits(scalar, c, windows, digits.data());
+
+                        const value_type *base_copies = copies.data() + i * rows;
+                        for (std::size_t k = 0; k < windows; ++k) {
+                            const std::int64_t digit = digits[k];
+                            if (digit == 0) {
+                                continue;
+                            }
+
+                            value_type &bucket =
+                                buckets[(k % stride) * buckets_count + (digit > 0 ? digit : -digit) - 1];
+                            const value_type &copy = base_copies[k / stride];
+                            bucket = bucket.mixed_add(digit > 0 ? copy : -copy);
+                        }
+                    }
+
+                    value_type result = value_type::zero();
+                    for (std::size_t t = stride; t-- > 0;) {
+                        for (std::size_t i = 0; i < c && !result.is_zero(); ++i) {
+                            result = result.doubled();
+                        }
+
+                        value_type running_sum = value_type::zero();
+                        value_type window_sum = value_type::zero();
+                        for (std::size_t b = buckets_count; b-- > 0;) {
+                            running_sum = running_sum + buckets[t * buckets_count + b];
+                            window_sum = window_sum + running_sum;
+                        }
+                        result = result + window_sum;
+                    }
+
+                    return result;
+                }
+
+                std::size_t serialized_size() const {
+                    return header_octets_num + copies.size() * point_octets_num;
+                }
+
+                /**
+                 * Writes the table as a header (magic, format version, bases count, window, stride, rows and
+                 * scalar bits, little-endian) followed by the copies in affine form, each prefixed with
+                 * an infinity flag.
+                 */
+                template<typename OutputIterator>
+                OutputIterator to_bytes(OutputIterator out) const {
+                    std::vector<chunk_type> buffer(serialized_size());
+                    chunk_type *p = buffer.data();
+
+                    p[0] = 'C';
+                    p[1] = '3';
+                    p[2] = 'M';
+                    p[3] = 'P';
+                    p = write_integral(p + 4, format_version, 4);
+                    p = write_integral(p, bases_count, 8);
+                    p = write_integral(p, c, 8);
+                    p = write_integral(p, stride, 8);
+                    p = write_integral(p, rows, 8);
+                    p = write_integral(p, field_type::modulus_bits, 8);
+
+                    for (const value_type &copy : copies) {
+                        p = point_codec::encode(copy, p);
+                    }
+
+                    return std::copy(buffer.begin(), buffer.end(), out);
+                }
+
+                std::vector<chunk_type> to_bytes() const {
+                    std::vector<chunk_type> result;
+                    result.reserve(serialized_size());
+                    to_bytes(std::back_inserter(result));
+                    return result;
+                }
+
+                /**
+                 * Restores a table from its byte representation, e.g. from a read-only memory mapping of
+                 * a file produced by to_bytes(). The first element of the result is false if the header
+                 * does not match this group and scalar field or if any coordinate is out of range.
+                 */
+                static std::pair<bool, multiexp_precomputed> from_bytes(const chunk_type *first,
+                                                                        const chunk_type *last) {
+                    multiexp_precomputed result;
+                    const std::size_t length = std::distance(first, last);
+
+                    if (length < header_octets_num || first[0] != 'C' || first[1] != '3' || first[2] != 'M' ||
+                        first[3] != 'P' || read_integral(first + 4, 4) != format_version ||
+                        read_integral(first + 40, 8) != field_type::modulus_bits) {
+                        return std::make_pair(false, result);
+                    }
+
+                    result.bases_count = read_integral(first + 8, 8);
+                    result.c = read_integral(first + 16, 8);
+                    result.stride = read_integral(first + 24, 8);
+                    result.rows = read_integral(first + 32, 8);
+
+                    const std::size_t points_count = (length - header_octets_num) / point_octets_num;
+                    if (result.c < 2 || result.c >= 32) {
+                        return std::make_pair(false, multiexp_precomputed());
+                    }
+
+                    const std::size_t windows = detail::signed_windows_count(field_type::modulus_bits, result.c);
+
+                    // bound the header fields by the payload before multiplying them
+                    if (result.stride == 0 || result.stride > windows ||
+                        result.rows != (windows + result.stride - 1) / result.stride ||
+                        result.bases_count > points_count || points_count != result.bases_count * result.rows ||
+                        (length - header_octets_num) % point_octets_num != 0) {
+                        return std::make_pair(false, multiexp_precomputed());
+                    }
+
+                    result.copies.reserve(result.bases_count * result.rows);
+
+                    bool valid = true;
+                    for (const chunk_type *p = first + header_octets_num; p != last; p += point_octets_num) {
+                        std::pair<bool, value_type> copy = point_codec::decode(p);
+                        valid = valid && copy.first;
+                        result.copies.emplace_back(copy.second);
+                    }
+
+                    return std::make_pair(valid, result);
+                }
+
+            private:
+                static std::size_t default_window(std::size_t length) {
+                    // same empirical estimate as in multiexp_method_BDLO12
+                    const std::size_t log2_length = length > 1 ? std::log2(length) : 1;
+                    return std::max<std::size_t>(2, log2_length - (log2_length / 3 - 2));
+                }
+
+                static chunk_type *write_integral(chunk_type *out, std::uint64_t value, std::size_t octets) {
+                    for (std::size_t i = 0; i < octets; ++i) {
+                        out[i] = static_cast<chunk_type>(value >> (8 * i));
+                    }
+                    return out + octets;
+                }
+
+                static std::uint64_t read_integral(const chunk_type *in, std::size_t octets) {
+                    std::uint64_t value = 0;
+                    for (std::size_t i = 0; i < octets; ++i) {
+                        value |= static_cast<std::uint64_t>(in[i]) << (8 * i);
+                    }
+                    return value;
+                }
+
+                std::size_t bases_count;
+                std::size_t c;
+                std::size_t stride;
+                std::size_t rows;
+
+                // copies[i * rows + j] = 2^{j * stride * c} * P_i in affine form
+                std::vector<value_type> copies;
+            };
+
+            template<typename GroupType, typename FieldType>
+            constexpr std::uint32_t const multiexp_precomputed<GroupType, FieldType>::format_version;
+
+            template<typename GroupType, typename FieldType>
+            constexpr std::size_t const multiexp_precomputed<GroupType, FieldType>::header_octets_num;
+
+            template<typename GroupType, typename FieldType>
+            constexpr std::size_t const multiexp_precomputed<GroupType, FieldType>::point_octets_num;
+
+            /**
+             * Multi-exponentiation against bases precomputed by multiexp_precomputed.
+             */
+            template<typename GroupType, typename FieldType, typename InputFieldIterator>
+            typename GroupType::value_type multiexp(const multiexp_precomputed<GroupType, FieldType> &precomputed,
+                                                    InputFieldIterator scalar_start,
+                                                    InputFieldIterator scalar_end) {
+                return precomputed.process(scalar_start, scalar_end);
+            }
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_MULTIEXP_PRECOMPUTED_HPP
@@ -0,0 +1,270 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_MULTIEXP_STREAMING_HPP
+#define CRYPTO3_ALGEBRA_MULTIEXP_STREAMING_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/algebra/multiexp/multiexp.hpp>
+#include <nil/crypto3/algebra/multiexp/detail/digits.hpp>
+#include <nil/crypto3/algebra/multiexp/detail/point_codec.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+
+            /**
+             * Pippenger accumulator that consumes (base, scalar) pairs chunk by chunk. Only the buckets of
+             * every window are kept between chunks, 2^{c-1} points per window with signed digits, so the
+             * memory used does not depend on the total number of bases.
+             */
+            template<typename GroupType, typename FieldType = typename GroupType::curve_type::scalar_field_type>
+            class multiexp_stream {
+            public:
+                typedef GroupType group_type;
+                typedef FieldType field_type;
+                typedef typename group_type::value_type value_type;
+                typedef typename field_type::value_type field_value_type;
+                typedef typename field_type::modulus_type modulus_type;
+
+                explicit multiexp_stream(std::size_t window) :
+                    c(window), windows(detail::signed_windows_count(field_type::modulus_bits, window)),
+                    buckets_count(std::size_t(1) << (window - 1)),
+                    buckets(windows * buckets_count, value_type::zero()), digits(windows) {
+                    BOOST_ASSERT(window > 1 && window < 32);
+                }
+
+                /**
+                 * Same window as multiexp_method_BDLO12 would pick for a single chunk, which keeps the bucket
+                 * state in the same order of magnitude as one chunk of bases.
+                 */
+                static std::size_t default_window(std::size_t chunk_size) {
+                    const std::size_t log2_length = chunk_size > 1 ? std::log2(chunk_size) : 1;
+                    return std::max<std::size_t>(2, log2_length - (log2_length / 3 - 2));
+                }
+
+                /**
+                 * Adds the contribution of one chunk of bases.
+                 * @param affine set when the bases have Z = 1, so that mixed additions can be used
+                 * @return the scalar iterator advanced past the consumed scalars
+                 */
+                template<typename InputBaseIterator, typename InputFieldIterator>
+                InputFieldIterator process(InputBaseIterator bases_first, InputBaseIterator bases_last,
+                                           InputFieldIterator scalar_it, bool affine = false) {
+                    for (; bases_first != bases_last; ++bases_first, ++scalar_it) {
+                        const modulus_type scalar = scalar_it->data.template convert_to<modulus_type>();
+                        if (!scalar.is_zero()) {
+                            add(*bases_first, -(*bases_first), scalar, affine);
+                        }
+                    }
+
+                    return scalar_it;
+                }
+
+                /**
+                 * Adds scalar * base. The negated base is passed in so that callers scattering one base
+                 * into several accumulators negate it only once.
+                 */
+                void add(const value_type &base, const value_type &negated_base, const modulus_type &scalar,
+                         bool affine = false) {
+                    detail::signed_window_digits(scalar, c, windows, digits.data());
+
+                    for (std::size_t k = 0; k < windows; ++k) {
+                        const std::int64_t digit = digits[k];
+                        if (digit == 0) {
+                            continue;
+                        }
+
+                        value_type &bucket = buckets[k * buckets_count + (digit > 0 ? digit : -digit) - 1];
+                        const value_type &addend = digit > 0 ? base : negated_base;
+                        bucket = affine ? bucket.mixed_add(addend) : bucket + addend;
+                    }
+                }
+
+                /**
+                 * Combines the buckets into sum_i scalar_i * P_i over everything processed so far.
+                 */
+                value_type result() const {
+                    value_type result = value_type::zero();
+
+                    for (std::size_t k = windows; k-- > 0;) {
+                        for (std::size_t i = 0; i < c && !result.is_zero(); ++i) {
+                            result = result.doubled();
+                        }
+
+                        value_type running_sum = value_type::zero();
+                        value_type window_sum = value_type::zero();
+                        for (std::size_t b = buckets_count; b-- > 0;) {
+                            running_sum = running_sum + buckets[k * buckets_count + b];
+                            window_sum = window_sum + running_sum;
+                        }
+                        result = result + window_sum;
+                    }
+
+                    return result;
+                }
+
+            private:
+                std::size_t c;
+                std::size_t windows;
+                std::size_t buckets_count;
+
+                // buckets[k * buckets_count + b] accumulates the bases whose k-th digit is +-(b + 1)
+                std::vector<value_type> buckets;
+                std::vector<std::int64_t> digits;
+            };
+
+            /**
+             * Multi-exponentiation over bases read from a single-pass source. Bases are pulled chunk_size
+             * at a time; the next chunk is read on a background thread while the current one is being
+             * accumulated, so at most two chunks are resident at any time.
+             */
+            template<typename GroupType, typename InputBaseIterator, typename InputFieldIterator>
+            typename GroupType::value_type multiexp_streaming(InputBaseIterator bases_first,
+                                                              InputBaseIterator bases_last,
+                                                              InputFieldIterator scalar_it,
+                                                              std::size_t chunk_size,
+                                                              std::size_t window = 0) {
+                typedef typename GroupType::value_type value_type;
+
+                BOOST_ASSERT(chunk_size > 0);
+
+                multiexp_stream<GroupType> stream(window != 0 ? window :
+                                                                 multiexp_stream<GroupType>::default_window(chunk_size));
+
+                auto read_chunk = [&bases_first, &bases_last, chunk_size](std::vector<value_type> &chunk) {
+                    chunk.clear();
+                    for (; chunk.size() < chunk_size && bases_first != bases_last; ++bases_first) {
+                        chunk.emplace_back(*bases_first);
+                    }
+                };
+
+                std::vector<value_type> current, next;
+                current.reserve(chunk_size);
+                next.reserve(chunk_size);
+
+                read_chunk(current);
+                while (!current.empty()) {
+                    std::future<void> prefetch = std::async(std::launch::async, read_chunk, std::ref(next));
+                    scalar_it = stream.process(current.cbegin(), current.cend(), scalar_it);
+                    prefetch.get();
+                    std::swap(current, next);
+                }
+
+                return stream.result();
+            }
+
+            /**
+             * Multi-exponentiation over bases stored as consecutive detail::affine_point_codec records, e.g.
+             * in a read-only memory mapping of an SRS file. Decoding of the next chunk overlaps with the
+             * accumulation of the current one, which also faults in the pages of the mapping ahead of use.
+             * The first element of the result is false if a record does not decode to a valid point.
+             */
+            template<typename GroupType, typename InputFieldIterator>
+            std::pair<bool, typename GroupType::value_type> multiexp_streaming(const std::uint8_t *bases_first,
+                                                                               const std::uint8_t *bases_last,
+                                                                               InputFieldIterator scalar_it,
+                                                                               std::size_t chunk_size,
+                                                                               std::size_t window = 0) {
+                typedef typename GroupType::value_type value_type;
+                typedef detail::affine_point_codec<GroupType> point_codec;
+
+                BOOST_ASSERT(chunk_size > 0);
+                BOOST_ASSERT((bases_last - bases_first) % point_codec::octets_num == 0);
+
+                multiexp_stream<GroupType> stream(window != 0 ? window :
+                                                                 multiexp_stream<GroupType>::default_window(chunk_size));
+
+                const std::uint8_t *position = bases_first;
+                auto decode_chunk = [&position, bases_last, chunk_size](std::vector<value_type> &chunk) {
+                    bool valid = true;
+                    chunk.clear();
+                    for (; chunk.size() < chunk_size && position != bases_last; position += point_codec::octets_num) {
+                        std::pair<bool, value_type> point = point_codec::decode(position);
+                        valid = valid && point.first;
+                        chunk.emplace_back(point.second);
+                    }
+                    return valid;
+                };
+
+                std::vector<value_type> current, next;
+                current.reserve(chunk_size);
+                next.reserve(chunk_size);
+
+                bool valid = decode_chunk(current);
+                while (!current.empty()) {
+                    std::future<bool> prefetch = std::async(std::launch::async, decode_chunk, std::ref(next));
+                    scalar_it = stream.process(current.cbegin(), current.cend(), scalar_it, true);
+                    valid = prefetch.get() && valid;
+                    std::swap(current, next);
+                }
+
+                return std::make_pair(valid, stream.result());
+            }
+
+            /**
+             * Writes bases in the record format read by multiexp_streaming.
+             */
+            template<typename GroupType, typename InputBaseIterator, typename OutputIterator>
+            OutputIterator write_streaming_bases(InputBaseIterator bases_first, InputBaseIterator bases_last,
+                                                 OutputIterator out) {
+                typedef detail::affine_point_codec<GroupType> point_codec;
+                typedef typename GroupType::value_type value_type;
+
+                constexpr static const std::size_t chunk_size = 1024;
+
+                std::vector<value_type> chunk;
+                chunk.reserve(chunk_size);
+
+                std::uint8_t record[point_codec::octets_num];
+                while (bases_first != bases_last) {
+                    chunk.clear();
+                    for (; chunk.size() < chunk_size && bases_first != bases_last; ++bases_first) {
+                        chunk.emplace_back(*bases_first);
+                    }
+
+                    // one field inversion per chunk instead of one per point
+                    batch_to_special<GroupType>(chunk);
+
+                    for (const value_type &base : chunk) {
+                        point_codec::encode(base, record);
+                        out = std::copy(record, record + point_codec::octets_num, out);
+                    }
+                }
+                return out;
+            }
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_MULTIEXP_STREAMING_HPP
@@ -0,0 +1,250 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_MULTIEXP_TUNING_HPP
+#define CRYPTO3_ALGEBRA_MULTIEXP_TUNING_HPP
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+
+            enum class multiexp_method_type { naive_plain, bos_coster, BDLO12 };
+
+            /**
+             * Method and window to use for instances of at least min_size elements
+             * (and less than min_size of the next range of the profile).
+             */
+            struct multiexp_tuning_range {
+                std::size_t min_size;
+                multiexp_method_type method;
+                // Pippenger window width, ignored by the other methods
+                std::size_t window;
+            };
+
+            /**
+             * Host-specific multiexp parameters produced by calibrate_multiexp() (see multiexp/calibration.hpp)
+             * for one group. The fixed-base window table has the same layout as
+             * curves::multiexp_params<GroupType>::fixed_base_exp_window_table and replaces it when non-empty.
+             */
+            struct multiexp_tuning_profile {
+                std::vector<multiexp_tuning_range> ranges;
+                std::vector<std::size_t> fixed_base_exp_window_table;
+
+                bool empty() const {
+                    return ranges.empty() && fixed_base_exp_window_table.empty();
+                }
+
+                const multiexp_tuning_range *find(std::size_t size) const {
+                    const multiexp_tuning_range *result = nullptr;
+                    for (const multiexp_tuning_range &range : ranges) {
+                        if (range.min_size > size) {
+                            break;
+                        }
+                        result = &range;
+                    }
+                    return result;
+                }
+            };
+
+            namespace detail {
+                inline const char *multiexp_method_name(multiexp_method_type method) {
+                    switch (method) {
+                        case multiexp_method_type::naive_plain:
+                            return "naive_plain";
+                        case multiexp_method_type::bos_coster:
+                            return "bos_coster";
+                        default:
+                            return "BDLO12";
+                    }
+                }
+
+                inline bool multiexp_method_from_name(const std::string &name, multiexp_method_type &method) {
+                    for (multiexp_method_type m : {multiexp_method_type::naive_plain, multiexp_method_type::bos_coster,
+                                                   multiexp_method_type::BDLO12}) {
+                        if (name == multiexp_method_name(m)) {
+                            method = m;
+                            return true;
+                        }
+                    }
+                    return false;
+                }
+
+                // widest window accepted from a profile: BDLO12 indexes its 2^window buckets with int shifts
+                constexpr std::size_t multiexp_max_window = 30;
+            }    // namespace detail
+
+            /**
+             * Profiles are stored as text, one section per group:
+             *
+             *     crypto3-multiexp-profile 1
+             *     group <key>
+             *     range <min_size> <method> <window>
+             *     fixed_base <threshold for window 1> <threshold for window 2> ...
+             *     end
+             *
+             * where <key> is multiexp_tuning<GroupType>::key().
+             */
+            inline void write_multiexp_tuning_profiles(
+                std::ostream &os,
+                const std::vector<std::pair<std::string, multiexp_tuning_profile>> &profiles) {
+                os << "crypto3-multiexp-profile 1\n";
+                for (const std::pair<std::string, multiexp_tuning_profile> &entry : profiles) {
+                    os << "group " << entry.first << "\n";
+                    for (const multiexp_tuning_range &range : entry.second.ranges) {
+                        os << "range " << range.min_size << " " << detail::multiexp_method_name(range.method) << " "
+                           << range.window << "\n";
+                    }
+                    if (!entry.second.fixed_base_exp_window_table.empty()) {
+                        os << "fixed_base";
+                        for (std::size_t threshold : entry.second.fixed_base_exp_window_table) {
+                            os << " " << threshold;
+                        }
+                        os << "\n";
+                    }
+                    os << "end\n";
+                }
+            }
+
+            /**
+             * Reads the section of a profile stream matching the given group key. The first element of the
+             * result is false if the stream is malformed or contains no such section. A BDLO12 range with a
+             * window outside [1, detail::multiexp_max_window], or a fixed-base table with more entries than
+             * that, makes the section malformed.
+             */
+            inline std::pair<bool, multiexp_tuning_profile> read_multiexp_tuning_profile(std::istream &is,
+                                                                                        const std::string &key) {
+                multiexp_tuning_profile profile;
+                std::string line, word;
+
+                if (!std::getline(is, line) || line != "crypto3-multiexp-profile 1") {
+                    return std::make_pair(false, profile);
+                }
+
+                bool in_section = false;
+                while (std::getline(is, line)) {
+                    std::istringstream tokens(line);
+                    if (!(tokens >> word)) {
+                        continue;
+                    }
+
+                    if (word == "group") {
+                        std::string group_key;
+                        tokens >> group_key;
+                        in_section = (group_key == key);
+                    } else if (word == "end") {
+                        if (in_section) {
+                            return std::make_pair(true, profile);
+                        }
+                    } else if (in_section && word == "range") {
+                        multiexp_tuning_range range;
+                        std::string method;
+                        if (!(tokens >> range.min_size >> method >> range.window) ||
+                            !detail::multiexp_method_from_name(method, range.method) ||
+                            (range.method == multiexp_method_type::BDLO12 &&
+                             (range.window == 0 || range.window > detail::multiexp_max_window)) ||
+                            (!profile.ranges.empty() && profile.ranges.back().min_size >= range.min_size)) {
+                            return std::make_pair(false, multiexp_tuning_profile());
+                        }
+                        profile.ranges.push_back(range);
+                    } else if (in_section && word == "fixed_base") {
+                        std::size_t threshold;
+                        while (tokens >> threshold) {
+                            // entry i selects window i + 1
+                            if (profile.fixed_base_exp_window_table.size() == detail::multiexp_max_window) {
+                                return std::make_pair(false, multiexp_tuning_profile());
+                            }
+                            profile.fixed_base_exp_window_table.push_back(threshold);
+                        }
+                    }
+                }
+
+                return std::make_pair(false, multiexp_tuning_profile());
+            }
+
+            /**
+             * Registry of the tuning profile used for GroupType. On first use the profile is loaded from
+             * the file named by the CRYPTO3_MULTIEXP_PROFILE environment variable, if set; without a profile
+             * the compiled-in heuristics are used. set() is meant to be called at startup, before
+             * multi-exponentiations are run concurrently.
+             */
+            template<typename GroupType>
+            struct multiexp_tuning {
+                typedef GroupType group_type;
+
+                static std::string key() {
+                    typedef typename group_type::underlying_field_type underlying_field_type;
+
+                    std::ostringstream os;
+                    os << std::hex << underlying_field_type::modulus << "x" << std::dec
+                       << underlying_field_type::arity;
+                    return os.str();
+                }
+
+                static const multiexp_tuning_profile &profile() {
+                    return storage();
+                }
+
+                static void set(const multiexp_tuning_profile &profile) {
+                    storage() = profile;
+                }
+
+                static bool load(std::istream &is) {
+                    std::pair<bool, multiexp_tuning_profile> result = read_multiexp_tuning_profile(is, key());
+                    if (result.first) {
+                        set(result.second);
+                    }
+                    return result.first;
+                }
+
+            private:
+                static multiexp_tuning_profile &storage() {
+                    static multiexp_tuning_profile instance = load_default();
+                    return instance;
+                }
+
+                static multiexp_tuning_profile load_default() {
+                    const char *path = std::getenv("CRYPTO3_MULTIEXP_PROFILE");
+                    if (path == nullptr) {
+                        return multiexp_tuning_profile();
+                    }
+
+                    std::ifstream file(path);
+                    return read_multiexp_tuning_profile(file, key()).second;
+                }
+            };
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_MULTIEXP_TUNING_HPP
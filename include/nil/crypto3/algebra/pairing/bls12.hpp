@@ -27,6 +27,7 @@
 #define CRYPTO3_ALGEBRA_PAIRING_BLS12_POLICY_HPP
 
 #include <numeric>
+#include <vector>
 
 #include <nil/crypto3/algebra/curves/jubjub.hpp>
 
@@ -70,9 +71,28 @@ namespace nil {
                     using g1_precomp = typename policy_type::g1_precomp;
                     using g2_precomp = typename policy_type::g2_precomp;
 
+                    using affine_ate_g1_precomp = typename policy_type::affine_ate_g1_precomputation;
+                    using affine_ate_g2_precomp = typename policy_type::affine_ate_g2_precomputation;
+
                     constexpr static const typename g2_type::underlying_field_type::value_type twist =
                         policy_type::twist;
 
+                    static inline affine_ate_g1_precomp
+                        affine_ate_precompute_g1(const typename g1_type::value_type &P) {
+                        return policy_type::affine_ate_precompute_g1(P);
+                    }
+
+                    static inline affine_ate_g2_precomp
+                        affine_ate_precompute_g2(const typename g2_type::value_type &Q) {
+                        return policy_type::affine_ate_precompute_g2(Q);
+                    }
+
+                    static inline typename gt_type::value_type
+                        affine_ate_miller_loop(const affine_ate_g1_precomp &prec_P,
+                                               const affine_ate_g2_precomp &prec_Q) {
+                        return policy_type::affine_ate_miller_loop(prec_P, prec_Q);
+                    }
+
                     static inline g1_precomp precompute_g1(const typename g1_type::value_type &P) {
                         return policy_type::precompute_g1(P);
                     }
@@ -98,11 +118,47 @@ namespace nil {
                         return policy_type::double_miller_loop(prec_P1, prec_Q1, prec_P2, prec_Q2);
                     }
 
+                    static inline typename gt_type::value_type
+                        multi_miller_loop(const std::vector<g1_precomp> &prec_P,
+                                          const std::vector<g2_precomp> &prec_Q) {
+                        return policy_type::multi_miller_loop(prec_P, prec_Q);
+                    }
+
+                    static inline typename gt_type::value_type
+                        multi_miller_loop(const std::vector<g1_precomp> &prec_P,
+                                          const std::vector<const g2_precomp *> &prec_Q) {
+                        return policy_type::multi_miller_loop(prec_P, prec_Q);
+                    }
+
+                    /**
+                     * Checks prod_i e(P_i, Q_i) == 1 with one shared Miller loop and a single final
+                     * exponentiation, e.g. for Groth16 or aggregate signature verification.
+                     */
+                    static inline bool pairing_product_is_one(const std::vector<g1_precomp> &prec_P,
+                                                              const std::vector<g2_precomp> &prec_Q) {
+                        return policy_type::final_exponentiation(policy_type::multi_miller_loop(prec_P, prec_Q)) ==
+                               gt_type::value_type::one();
+                    }
+
                     static inline typename gt_type::value_type
                         final_exponentiation(const typename gt_type::value_type &elt) {
                         return policy_type::final_exponentiation(elt);
                     }
 
+                    static inline typename gt_type::value_type
+                        final_exponentiation(const typename gt_type::value_type &elt,
+                                             const typename gt_type::value_type &elt_inv) {
+                        return policy_type::final_exponentiation(elt, elt_inv);
+                    }
+
+                    static inline bool cyclotomic_subgroup_check(const typename gt_type::value_type &elt) {
+                        return policy_type::cyclotomic_subgroup_check(elt);
+                    }
+
+                    static inline bool gt_subgroup_check(const typename gt_type::value_type &elt) {
+                        return policy_type::gt_subgroup_check(elt);
+                    }
+
                     static inline typename gt_type::value_type miller_loop(const g1_precomp &prec_P,
                                                                            const g2_precomp &prec_Q) {
                         return policy_type::miller_loop(prec_P, prec_Q);
@@ -0,0 +1,298 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_PAIRING_BLS_SIGNATURE_HPP
+#define CRYPTO3_ALGEBRA_PAIRING_BLS_SIGNATURE_HPP
+
+#include <cstdint>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/random/random_device.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+
+#include <nil/crypto3/detail/parallel.hpp>
+
+#include <nil/crypto3/algebra/algorithms/pair.hpp>
+#include <nil/crypto3/algebra/curves/detail/h2c/ep.hpp>
+#include <nil/crypto3/algebra/curves/detail/h2c/ep2.hpp>
+#include <nil/crypto3/algebra/multiexp/multiexp.hpp>
+#include <nil/crypto3/algebra/multiexp/policies.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace pairing {
+
+                /**
+                 * BLS variant with public keys in G1 and signatures (and hashed messages) in G2.
+                 */
+                template<typename CurveType>
+                struct bls_min_pk {
+                    typedef CurveType curve_type;
+                    typedef typename curve_type::g1_type public_key_group_type;
+                    typedef typename curve_type::g2_type signature_group_type;
+                    typedef curves::detail::ep2_map<signature_group_type> hash_to_curve_type;
+
+                    /**
+                     * Appends the pairing argument e(public_key_side, signature_side) in (G1, G2) order.
+                     */
+                    static void append_pair(const typename public_key_group_type::value_type &public_key_side,
+                                            const typename signature_group_type::value_type &signature_side,
+                                            std::vector<typename curve_type::g1_type::value_type> &P,
+                                            std::vector<typename curve_type::g2_type::value_type> &Q) {
+                        P.emplace_back(public_key_side);
+                        Q.emplace_back(signature_side);
+                    }
+                };
+
+                /**
+                 * BLS variant with public keys in G2 and signatures (and hashed messages) in G1.
+                 */
+                template<typename CurveType>
+                struct bls_min_sig {
+                    typedef CurveType curve_type;
+                    typedef typename curve_type::g2_type public_key_group_type;
+                    typedef typename curve_type::g1_type signature_group_type;
+                    typedef curves::detail::ep_map<signature_group_type> hash_to_curve_type;
+
+                    static void append_pair(const typename public_key_group_type::value_type &public_key_side,
+                                            const typename signature_group_type::value_type &signature_side,
+                                            std::vector<typename curve_type::g1_type::value_type> &P,
+                                            std::vector<typename curve_type::g2_type::value_type> &Q) {
+                        P.emplace_back(signature_side);
+                        Q.emplace_back(public_key_side);
+                    }
+                };
+
+                /**
+                 * BLS signatures (Boneh, Lynn and Shacham; draft-irtf-cfrg-bls-signature) over the hash to curve
+                 * maps of this library, VariantType being bls_min_pk or bls_min_sig. A signature on msg is
+                 * sk * H(msg), and every verification reduces to checking that a product of pairings is one,
+                 * i.e. to a single multi-Miller loop and final exponentiation.
+                 *
+                 * Public keys and signatures are expected to have passed the subgroup check on deserialization.
+                 * The domain separation tag dst is the one of the ciphersuite, e.g.
+                 * "BLS_SIG_BLS12381G2_XMD:SHA-256_SSWU_RO_NUL_" for bls_min_pk<bls12<381>>.
+                 */
+                template<typename VariantType>
+                struct bls_signature {
+                    typedef VariantType variant_type;
+                    typedef typename variant_type::curve_type curve_type;
+                    typedef typename curve_type::scalar_field_type scalar_field_type;
+                    typedef typename scalar_field_type::value_type private_key_type;
+                    typedef typename variant_type::public_key_group_type::value_type public_key_type;
+                    typedef typename variant_type::signature_group_type::value_type signature_type;
+                    typedef typename curve_type::g1_type::value_type g1_value_type;
+                    typedef typename curve_type::g2_type::value_type g2_value_type;
+
+                    /**
+                     * Bit length of the random coefficients of batch_verify.
+                     */
+                    constexpr static const std::size_t batch_coefficient_bits = 128;
+
+                    static public_key_type public_key(const private_key_type &sk) {
+                        return sk * public_key_type::one();
+                    }
+
+                    template<typename InputType, typename DstType>
+                    static signature_type hash_to_point(const InputType &msg, const DstType &dst) {
+                        return variant_type::hash_to_curve_type::hash_to_curve(msg, dst);
+                    }
+
+                    template<typename InputType, typename DstType>
+                    static signature_type sign(const private_key_type &sk, const InputType &msg, const DstType &dst) {
+                        return sk * hash_to_point(msg, dst);
+                    }
+
+                    /**
+                     * Sum of the points of [first, last), either signatures or public keys, split over
+                     * thread_count threads (0 meaning one per hardware thread).
+                     */
+                    template<typename InputPointIterator>
+                    static typename std::iterator_traits<InputPointIterator>::value_type
+                        aggregate(InputPointIterator first, InputPointIterator last, std::size_t thread_count = 1) {
+                        typedef typename std::iterator_traits<InputPointIterator>::value_type point_type;
+
+                        point_type result = point_type::zero();
+                        std::mutex result_mutex;
+
+                        nil::crypto3::detail::parallel_for(
+                            std::distance(first, last), thread_count, [&](std::size_t begin, std::size_t end) {
+                                point_type partial = point_type::zero();
+                                InputPointIterator it = std::next(first, begin);
+                                for (std::size_t i = begin; i < end; ++i, ++it) {
+                                    partial = partial + *it;
+                                }
+
+                                std::lock_guard<std::mutex> lock(result_mutex);
+                                result = result + partial;
+                            });
+
+                        return result;
+                    }
+
+                    /**
+                     * Checks e(pk, H(msg)) == e(g, sig), g being the generator of the public key group, as
+                     * e(-g, sig) * e(pk, H(msg)) == 1.
+                     */
+                    template<typename InputType, typename DstType>
+                    static bool verify(const public_key_type &pk, const InputType &msg, const signature_type &sig,
+                                       const DstType &dst) {
+                        if (pk.is_zero()) {
+                            return false;
+                        }
+
+                        std::vector<g1_value_type> P;
+                        std::vector<g2_value_type> Q;
+                        variant_type::append_pair(-public_key_type::one(), sig, P, Q);
+                        variant_type::append_pair(pk, hash_to_point(msg, dst), P, Q);
+
+                        return pairing_product_is_one<curve_type>(P, Q);
+                    }
+
+                    /**
+                     * Verifies an aggregate signature of [pk_first, pk_last) on a single message. The public
+                     * keys must come with proofs of possession, as required by the FastAggregateVerify of the
+                     * proof of possession scheme.
+                     */
+                    template<typename InputPublicKeyIterator, typename InputType, typename DstType>
+                    static bool fast_aggregate_verify(InputPublicKeyIterator pk_first, InputPublicKeyIterator pk_last,
+                                                      const InputType &msg, const signature_type &sig,
+                                                      const DstType &dst, std::size_t thread_count = 1) {
+                        if (pk_first == pk_last) {
+                            return false;
+                        }
+
+                        return verify(aggregate(pk_first, pk_last, thread_count), msg, sig, dst);
+                    }
+
+                    /**
+                     * Verifies n independent (pk_i, msg_i, sig_i) triples at once. With random
+                     * batch_coefficient_bits-bit r_i it checks
+                     *
+                     *     e(-g, sum_i r_i * sig_i) * prod_m e(sum_{i: msg_i = m} r_i * pk_i, H(m)) == 1,
+                     *
+                     * computing the signature combination with a multi-exponentiation, hashing every distinct
+                     * message once and running a single multi-Miller loop over the distinct messages and a
+                     * single final exponentiation. A batch containing an invalid signature is accepted with
+                     * probability at most 2^-batch_coefficient_bits; on failure the caller can fall back to
+                     * verify to single out the invalid triples.
+                     *
+                     * Hashing, coefficient multiplications and Miller loops are spread over thread_count threads.
+                     */
+                    template<typename InputPublicKeyIterator, typename InputMessageIterator,
+                             typename InputSignatureIterator, typename DstType>
+                    static bool batch_verify(InputPublicKeyIterator pk_first, InputPublicKeyIterator pk_last,
+                                             InputMessageIterator msg_first, InputSignatureIterator sig_first,
+                                             const DstType &dst, std::size_t thread_count = 1) {
+                        typedef typename scalar_field_type::modulus_type modulus_type;
+
+                        const std::vector<public_key_type> pks(pk_first, pk_last);
+                        const std::size_t n = pks.size();
+                        if (n == 0) {
+                            return true;
+                        }
+
+                        std::vector<signature_type> sigs;
+                        sigs.reserve(n);
+                        for (std::size_t i = 0; i < n; ++i, ++sig_first) {
+                            sigs.emplace_back(*sig_first);
+                        }
+
+                        // distinct messages and the group of every triple
+                        std::unordered_map<std::string, std::size_t> message_index;
+                        std::vector<std::vector<std::uint8_t>> messages;
+                        std::vector<std::size_t> groups(n);
+                        for (std::size_t i = 0; i < n; ++i, ++msg_first) {
+                            if (pks[i].is_zero()) {
+                                return false;
+                            }
+
+                            const std::string key(std::begin(*msg_first), std::end(*msg_first));
+                            const auto inserted = message_index.emplace(key, messages.size());
+                            if (inserted.second) {
+                                messages.emplace_back(key.begin(), key.end());
+                            }
+                            groups[i] = inserted.first->second;
+                        }
+
+                        std::vector<private_key_type> coefficients;
+                        coefficients.reserve(n);
+                        boost::random_device rd;
+                        boost::random::uniform_int_distribution<std::uint64_t> distribution;
+                        for (std::size_t i = 0; i < n; ++i) {
+                            modulus_type r = 0;
+                            for (std::size_t j = 0; j < batch_coefficient_bits / 64; ++j) {
+                                r <<= 64;
+                                r |= distribution(rd);
+                            }
+                            coefficients.emplace_back(r.is_zero() ? modulus_type(1) : r);
+                        }
+
+                        std::vector<signature_type> hashes(messages.size());
+                        nil::crypto3::detail::parallel_for(
+                            messages.size(), thread_count, [&](std::size_t begin, std::size_t end) {
+                                for (std::size_t m = begin; m < end; ++m) {
+                                    hashes[m] = hash_to_point(messages[m], dst);
+                                }
+                            });
+
+                        std::vector<public_key_type> weighted_pks(n);
+                        nil::crypto3::detail::parallel_for(n, thread_count, [&](std::size_t begin, std::size_t end) {
+                            for (std::size_t i = begin; i < end; ++i) {
+                                weighted_pks[i] = coefficients[i] * pks[i];
+                            }
+                        });
+
+                        std::vector<public_key_type> grouped_pks(messages.size(), public_key_type::zero());
+                        for (std::size_t i = 0; i < n; ++i) {
+                            grouped_pks[groups[i]] = grouped_pks[groups[i]] + weighted_pks[i];
+                        }
+
+                        const signature_type combined_sig = multiexp<policies::multiexp_method_BDLO12>(
+                            sigs.cbegin(), sigs.cend(), coefficients.cbegin(), coefficients.cend(), 1);
+
+                        std::vector<g1_value_type> P;
+                        std::vector<g2_value_type> Q;
+                        P.reserve(messages.size() + 1);
+                        Q.reserve(messages.size() + 1);
+                        variant_type::append_pair(-public_key_type::one(), combined_sig, P, Q);
+                        for (std::size_t m = 0; m < messages.size(); ++m) {
+                            variant_type::append_pair(grouped_pks[m], hashes[m], P, Q);
+                        }
+
+                        return pairing_product_is_one<curve_type>(P, Q, thread_count);
+                    }
+                };
+            }    // namespace pairing
+        }        // namespace algebra
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_PAIRING_BLS_SIGNATURE_HPP
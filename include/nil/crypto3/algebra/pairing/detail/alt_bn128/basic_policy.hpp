@@ -26,7 +26,12 @@
 #ifndef CRYPTO3_ALGEBRA_PAIRING_ALT_BN128_BASIC_POLICY_HPP
 #define CRYPTO3_ALGEBRA_PAIRING_ALT_BN128_BASIC_POLICY_HPP
 
+#include <array>
+#include <cstdint>
+
 #include <nil/crypto3/algebra/curves/detail/alt_bn128/basic_policy.hpp>
+#include <nil/crypto3/algebra/curves/detail/alt_bn128/g1.hpp>
+#include <nil/crypto3/algebra/curves/detail/alt_bn128/g2.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -50,8 +55,8 @@ namespace nil {
                         using fqe_type = typename policy_type::g2_field_type;
                         using fqk_type = typename policy_type::gt_field_type;
 
-                        using g1_type = policy_type::g1_field_type;
-                        using g2_type = policy_type::g2_field_type;
+                        using g1_type = curves::detail::alt_bn128_g1<254>;
+                        using g2_type = curves::detail::alt_bn128_g2<254>;
                         using gt_type = typename policy_type::gt_field_type;
 
                         constexpr static const std::size_t base_field_bits = policy_type::base_field_type::modulus_bits;
@@ -62,16 +67,30 @@ namespace nil {
                         constexpr static const std::size_t number_type_max_bits = base_field_bits;
 
                         constexpr static const number_type ate_loop_count = 0x19D797039BE763BA8_cppui254;
+                        /* ate_loop_count = 6x + 2 in non-adjacent form, most significant digit first */
+                        constexpr static const std::size_t ate_loop_count_naf_size = 66;
+                        constexpr static const std::size_t ate_loop_count_naf_weight = 22;
+                        constexpr static const std::array<std::int8_t, ate_loop_count_naf_size> ate_loop_count_naf = {
+                            1, 0, -1, 0, 1, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0,
+                            0, -1, 0, 1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, -1, 0, -1, 0, 0, 1, 0, 0, 0, -1, 0, 0,
+                            -1, 0, 1, 0, 1, 0, 0, 0};
                         constexpr static const bool ate_is_loop_count_neg = false;
-                        constexpr static const extended_number_type final_exponent = extended_number_type(
-                            0x2F4B6DC97020FDDADF107D20BC842D43BF6369B1FF6A1C71015F3F7BE2E1E30A73BB94FEC0DAF15466B2383A5D3EC3D15AD524D8F70C54EFEE1BD8C3B21377E563A09A1B705887E72ECEADDEA3790364A61F676BAAF977870E88D5C6C8FEF0781361E443AE77F5B63A2A2264487F2940A8B1DDB3D15062CD0FB2015DFC6668449AED3CC48A82D0D602D268C7DAAB6A41294C0CC4EBE5664568DFC50E1648A45A4A1E3A5195846A3ED011A337A02088EC80E0EBAE8755CFE107ACF3AAFB40494E406F804216BB10CF430B0F37856B42DB8DC5514724EE93DFB10826F0DD4A0364B9580291D2CD65664814FDE37CA80BB4EA44EACC5E641BBADF423F9A2CBF813B8D145DA90029BAEE7DDADDA71C7F3811C4105262945BBA1668C3BE69A3C230974D83561841D766F9C9D570BB7FBE04C7E8A6C3C760C0DE81DEF35692DA361102B6B9B2B918837FA97896E84ABB40A4EFB7E54523A486964B64CA86F120_cppui2790);
+                        // constexpr static const extended_number_type final_exponent = extended_number_type(
+                        //    0x2F4B6DC97020FDDADF107D20BC842D43BF6369B1FF6A1C71015F3F7BE2E1E30A73BB94FEC0DAF15466B2383A5D3EC3D15AD524D8F70C54EFEE1BD8C3B21377E563A09A1B705887E72ECEADDEA3790364A61F676BAAF977870E88D5C6C8FEF0781361E443AE77F5B63A2A2264487F2940A8B1DDB3D15062CD0FB2015DFC6668449AED3CC48A82D0D602D268C7DAAB6A41294C0CC4EBE5664568DFC50E1648A45A4A1E3A5195846A3ED011A337A02088EC80E0EBAE8755CFE107ACF3AAFB40494E406F804216BB10CF430B0F37856B42DB8DC5514724EE93DFB10826F0DD4A0364B9580291D2CD65664814FDE37CA80BB4EA44EACC5E641BBADF423F9A2CBF813B8D145DA90029BAEE7DDADDA71C7F3811C4105262945BBA1668C3BE69A3C230974D83561841D766F9C9D570BB7FBE04C7E8A6C3C760C0DE81DEF35692DA361102B6B9B2B918837FA97896E84ABB40A4EFB7E54523A486964B64CA86F120_cppui2790);
 
-                        constexpr static const number_type final_exponent_z = number_type(0x44E992B44A6909F1);
-                        constexpr static const number_type final_exponent_is_z_neg = false;
+                        constexpr static const number_type final_exponent_z = number_type(0x44E992B44A6909F1_cppui64);
+                        constexpr static const bool final_exponent_is_z_neg = false;
                     };
 
                     constexpr typename alt_bn128_basic_policy<254>::number_type const
                         alt_bn128_basic_policy<254>::ate_loop_count;
+                    constexpr typename alt_bn128_basic_policy<254>::number_type const
+                        alt_bn128_basic_policy<254>::final_exponent_z;
+
+                    constexpr std::array<std::int8_t, alt_bn128_basic_policy<254>::ate_loop_count_naf_size> const
+                        alt_bn128_basic_policy<254>::ate_loop_count_naf;
+                    constexpr bool const alt_bn128_basic_policy<254>::ate_is_loop_count_neg;
+                    constexpr bool const alt_bn128_basic_policy<254>::final_exponent_is_z_neg;
                 }    // namespace detail
             }        // namespace pairing
         }            // namespace algebra
@@ -26,9 +26,18 @@
 #ifndef CRYPTO3_ALGEBRA_PAIRING_ALT_BN128_FUNCTIONS_HPP
 #define CRYPTO3_ALGEBRA_PAIRING_ALT_BN128_FUNCTIONS_HPP
 
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/algebra/fields/detail/batch_inversion.hpp>
+#include <nil/crypto3/algebra/fields/detail/exponentiation.hpp>
 #include <nil/crypto3/algebra/pairing/detail/alt_bn128/basic_policy.hpp>
 
-#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
+#include <nil/crypto3/multiprecision/number.hpp>
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -49,8 +58,8 @@ namespace nil {
                         using fqe_type = typename policy_type::fqe_type;
                         using fqk_type = typename policy_type::fqk_type;
 
-                        using g1_type = curves::detail::alt_bn128_g1<254>;
-                        using g2_type = curves::detail::alt_bn128_g2<254>;
+                        using g1_type = typename policy_type::g1_type;
+                        using g2_type = typename policy_type::g2_type;
                         using gt_type = typename policy_type::gt_type;
 
                         constexpr static const typename policy_type::number_type ate_loop_count =
@@ -98,10 +107,47 @@ namespace nil {
                             }
                         };
 
+                        typedef ate_g1_precomp g1_precomp;
+                        typedef ate_g2_precomp g2_precomp;
+
+                        /* affine ate precomputation: lines normalized so that ell_VW = 1 */
+
+                        constexpr static const std::size_t affine_ate_coeffs_num =
+                            (policy_type::ate_loop_count_naf_size - 1) + (policy_type::ate_loop_count_naf_weight - 1) +
+                            2;
+
+                        struct affine_ate_g1_precomputation {
+                            Fq PX;
+                            Fq PY;
+
+                            bool operator==(const affine_ate_g1_precomputation &other) const {
+                                return (this->PX == other.PX && this->PY == other.PY);
+                            }
+                        };
+
+                        struct affine_ate_coeffs {
+                            Fq2 ell_0;
+                            Fq2 ell_VV;
+
+                            bool operator==(const affine_ate_coeffs &other) const {
+                                return (this->ell_0 == other.ell_0 && this->ell_VV == other.ell_VV);
+                            }
+                        };
+
+                        struct affine_ate_g2_precomputation {
+                            Fq2 QX;
+                            Fq2 QY;
+                            std::array<affine_ate_coeffs, affine_ate_coeffs_num> coeffs;
+
+                            bool operator==(const affine_ate_g2_precomputation &other) const {
+                                return (this->QX == other.QX && this->QY == other.QY && this->coeffs == other.coeffs);
+                            }
+                        };
+
                     private:
                         /*************************  FINAL EXPONENTIATIONS  ***********************************/
 
-                        static gt final_exponentiation_first_chunk(const gt &elt) {
+                        static gt final_exponentiation_first_chunk(const gt &elt, const gt &elt_inv) {
 
                             /*
                               Computes result = elt^((q^6-1)*(q^2+1)).
@@ -109,14 +155,14 @@ namespace nil {
                                  elt^((q^6-1)*(q^2+1)) = (conj(elt) * elt^(-1))^(q^2+1)
                               More precisely:
                               A = conj(elt)
-                              B = elt.inversed()
+                              B = elt^(-1)
                               C = A * B
                               D = C.Frobenius_map(2)
                               result = D * C
                             */
 
-                            const gt A = gt(elt.c0, -elt.c1);
-                            const gt B = elt.inversed();
+                            const gt A = elt.unitary_inversed();
+                            const gt B = elt_inv;
                             const gt C = A * B;
                             const gt D = C.Frobenius_map(2);
                             const gt result = D * C;
@@ -126,7 +172,9 @@ namespace nil {
 
                         static gt exp_by_neg_z(const gt &elt) {
 
-                            gt result = elt.cyclotomic_exp(policy_type::final_exponent_z);
+                            static const fields::detail::cyclotomic_wnaf_exponent z(policy_type::final_exponent_z);
+
+                            gt result = elt.cyclotomic_exp(z);
 
                             if (!policy_type::final_exponent_is_z_neg) {
                                 result = result.unitary_inversed();
@@ -211,12 +259,46 @@ namespace nil {
                             /* OLD naive version:
                                 gt result = elt^final_exponent;
                             */
-                            gt A = final_exponentiation_first_chunk(elt);
+                            return final_exponentiation(elt, elt.inversed());
+                        }
+
+                        /**
+                         * Same as final_exponentiation(elt), with elt_inv = elt^(-1) supplied by the caller, e.g.
+                         * from a batch inversion.
+                         */
+                        static gt final_exponentiation(const gt &elt, const gt &elt_inv) {
+                            gt A = final_exponentiation_first_chunk(elt, elt_inv);
                             gt result = final_exponentiation_last_chunk(A);
 
                             return result;
                         }
 
+                        /**
+                         * Checks elt^(q^4 + 1) == elt^(q^2), i.e. that elt lies in the cyclotomic subgroup of order
+                         * q^4 - q^2 + 1 where cyclotomic squarings and unitary inversions are valid.
+                         */
+                        static bool cyclotomic_subgroup_check(const gt &elt) {
+                            return elt != gt::zero() && elt.Frobenius_map(4) * elt == elt.Frobenius_map(2);
+                        }
+
+                        /**
+                         * GT membership test from Scott, "A note on group membership tests for G1, G2 and GT on
+                         * BLS pairing-friendly curves" (ePrint 2021/1130), applied to BN curves: since
+                         * q = 6z^2 mod r and gcd(q - 6z^2, q^4 - q^2 + 1) = r, a cyclotomic elt lies in GT iff
+                         * elt^q == elt^(6z^2), which costs two exponentiations by z instead of one by r.
+                         */
+                        static bool gt_subgroup_check(const gt &elt) {
+                            if (!cyclotomic_subgroup_check(elt)) {
+                                return false;
+                            }
+
+                            const gt A = exp_by_neg_z(exp_by_neg_z(elt));    // = elt^(z^2)
+                            const gt B = A.cyclotomic_squared();             // = elt^(2z^2)
+                            const gt C = B.cyclotomic_squared() * B;         // = elt^(6z^2)
+
+                            return elt.Frobenius_map(1) == C;
+                        }
+
                     private:
                         /* ate pairing */
 
@@ -229,7 +311,7 @@ namespace nil {
                             const Fq2 B = Y.squared();                    // B = Y1^2
                             const Fq2 C = Z.squared();                    // C = Z1^2
                             const Fq2 D = C + C + C;                      // D = 3 * C
-                            const Fq2 E = twist_coeff_b * D;              // E = twist_b * D
+                            const Fq2 E = current.twist_coeff_b * D;      // E = twist_b * D
                             const Fq2 F = E + E + E;                      // F = 3 * E
                             const Fq2 G = two_inv * (B + F);              // G = (B+F)/2
                             const Fq2 H = (Y + Z).squared() - (B + C);    // H = (Y1+Z1)^2-(B+C)
@@ -280,7 +362,8 @@ namespace nil {
 
                         static ate_g2_precomp ate_precompute_g2(const g2 &Q) {
 
-                            g2 Qcopy(Q).to_affine();
+                            g2 Qcopy(Q.to_affine());
+                            const g2 minus_Q = -Qcopy;
 
                             Fq two_inv = Fq(0x02).inversed();    // could add to global params if needed
 
@@ -293,24 +376,17 @@ namespace nil {
                             R.Y = Qcopy.Y;
                             R.Z = Fq2::one();
 
-                            const typename policy_type::number_type &loop_count = policy_type::ate_loop_count;
-
-                            bool found_one = false;
                             ate_ell_coeffs c;
 
-                            for (long i = loop_count.max_bits(); i >= 0; --i) {
-                                const bool bit = loop_count.test_bit(i);
-                                if (!found_one) {
-                                    /* this skips the MSB itself */
-                                    found_one |= bit;
-                                    continue;
-                                }
+                            /* the most significant digit is skipped, R starts at Q */
+                            for (std::size_t i = 1; i < policy_type::ate_loop_count_naf_size; ++i) {
+                                const std::int8_t digit = policy_type::ate_loop_count_naf[i];
 
                                 doubling_step_for_flipped_miller_loop(two_inv, R, c);
                                 result.coeffs.push_back(c);
 
-                                if (bit) {
-                                    mixed_addition_step_for_flipped_miller_loop(Qcopy, R, c);
+                                if (digit != 0) {
+                                    mixed_addition_step_for_flipped_miller_loop(digit > 0 ? Qcopy : minus_Q, R, c);
                                     result.coeffs.push_back(c);
                                 }
                             }
@@ -338,30 +414,19 @@ namespace nil {
 
                             gt f = gt::one();
 
-                            bool found_one = false;
                             std::size_t idx = 0;
 
-                            const typename policy_type::number_type &loop_count = policy_type::ate_loop_count;
-
                             ate_ell_coeffs c;
 
-                            for (long i = loop_count.max_bits(); i >= 0; --i) {
-                                const bool bit = loop_count.test_bit(i);
-                                if (!found_one) {
-                                    /* this skips the MSB itself */
-                                    found_one |= bit;
-                                    continue;
-                                }
-
-                                /* code below gets executed for all bits (EXCEPT the MSB itself) of
-                                   param_p (skipping leading zeros) in MSB to LSB
-                                   order */
+                            /* the most significant digit is skipped, R starts at Q */
+                            for (std::size_t i = 1; i < policy_type::ate_loop_count_naf_size; ++i) {
+                                const std::int8_t digit = policy_type::ate_loop_count_naf[i];
 
                                 c = prec_Q.coeffs[idx++];
                                 f = f.squared();
                                 f = f.mul_by_024(c.ell_0, prec_P.PY * c.ell_VW, prec_P.PX * c.ell_VV);
 
-                                if (bit) {
+                                if (digit != 0) {
                                     c = prec_Q.coeffs[idx++];
                                     f = f.mul_by_024(c.ell_0, prec_P.PY * c.ell_VW, prec_P.PX * c.ell_VV);
                                 }
@@ -385,22 +450,11 @@ namespace nil {
 
                             gt f = gt::one();
 
-                            bool found_one = false;
                             std::size_t idx = 0;
 
-                            const typename policy_type::number_type &loop_count = policy_type::ate_loop_count;
-
-                            for (long i = loop_count.max_bits(); i >= 0; --i) {
-                                const bool bit = loop_count.test_bit(i);
-                                if (!found_one) {
-                                    /* this skips the MSB itself */
-                                    found_one |= bit;
-                                    continue;
-                                }
-
-                                /* code below gets executed for all bits (EXCEPT the MSB itself) of
-                                   param_p (skipping leading zeros) in MSB to LSB
-                                   order */
+                            /* the most significant digit is skipped, R starts at Q */
+                            for (std::size_t i = 1; i < policy_type::ate_loop_count_naf_size; ++i) {
+                                const std::int8_t digit = policy_type::ate_loop_count_naf[i];
 
                                 ate_ell_coeffs c1 = prec_Q1.coeffs[idx];
                                 ate_ell_coeffs c2 = prec_Q2.coeffs[idx];
@@ -408,16 +462,17 @@ namespace nil {
 
                                 f = f.squared();
 
-                                f = f.mul_by_024(c1.ell_0, prec_P1.PY * c1.ell_VW, prec_P1.PX * c1.ell_VV);
-                                f = f.mul_by_024(c2.ell_0, prec_P2.PY * c2.ell_VW, prec_P2.PX * c2.ell_VV);
+                                f = f * gt::mul_024_by_024(c1.ell_0, prec_P1.PY * c1.ell_VW, prec_P1.PX * c1.ell_VV,
+                                                           c2.ell_0, prec_P2.PY * c2.ell_VW, prec_P2.PX * c2.ell_VV);
 
-                                if (bit) {
+                                if (digit != 0) {
                                     ate_ell_coeffs c1 = prec_Q1.coeffs[idx];
                                     ate_ell_coeffs c2 = prec_Q2.coeffs[idx];
                                     ++idx;
 
-                                    f = f.mul_by_024(c1.ell_0, prec_P1.PY * c1.ell_VW, prec_P1.PX * c1.ell_VV);
-                                    f = f.mul_by_024(c2.ell_0, prec_P2.PY * c2.ell_VW, prec_P2.PX * c2.ell_VV);
+                                    f = f * gt::mul_024_by_024(c1.ell_0, prec_P1.PY * c1.ell_VW,
+                                                               prec_P1.PX * c1.ell_VV, c2.ell_0,
+                                                               prec_P2.PY * c2.ell_VW, prec_P2.PX * c2.ell_VV);
                                 }
                             }
 
@@ -428,18 +483,145 @@ namespace nil {
                             ate_ell_coeffs c1 = prec_Q1.coeffs[idx];
                             ate_ell_coeffs c2 = prec_Q2.coeffs[idx];
                             ++idx;
-                            f = f.mul_by_024(c1.ell_0, prec_P1.PY * c1.ell_VW, prec_P1.PX * c1.ell_VV);
-                            f = f.mul_by_024(c2.ell_0, prec_P2.PY * c2.ell_VW, prec_P2.PX * c2.ell_VV);
+                            f = f * gt::mul_024_by_024(c1.ell_0, prec_P1.PY * c1.ell_VW, prec_P1.PX * c1.ell_VV,
+                                                       c2.ell_0, prec_P2.PY * c2.ell_VW, prec_P2.PX * c2.ell_VV);
 
                             c1 = prec_Q1.coeffs[idx];
                             c2 = prec_Q2.coeffs[idx];
                             ++idx;
-                            f = f.mul_by_024(c1.ell_0, prec_P1.PY * c1.ell_VW, prec_P1.PX * c1.ell_VV);
-                            f = f.mul_by_024(c2.ell_0, prec_P2.PY * c2.ell_VW, prec_P2.PX * c2.ell_VV);
+                            f = f * gt::mul_024_by_024(c1.ell_0, prec_P1.PY * c1.ell_VW, prec_P1.PX * c1.ell_VV,
+                                                       c2.ell_0, prec_P2.PY * c2.ell_VW, prec_P2.PX * c2.ell_VV);
 
                             return f;
                         }
 
+                        // n pairs share one chain of squarings of f
+                        static gt ate_multi_miller_loop(const std::vector<ate_g1_precomp> &prec_P,
+                                                        const std::vector<const ate_g2_precomp *> &prec_Q) {
+                            BOOST_ASSERT(prec_P.size() == prec_Q.size());
+
+                            gt f = gt::one();
+                            // set until the first lines are multiplied in, so that the squaring of f and the
+                            // multiplication of one by the first lines can be skipped
+                            bool f_is_one = true;
+
+                            std::size_t idx = 0;
+
+                            /* lines are multiplied together in pairs (sparse by sparse) before one dense
+                               multiplication into f */
+                            auto mul_by_lines = [&prec_P, &prec_Q, &f, &f_is_one](std::size_t idx) {
+                                std::size_t j = 0;
+                                for (; j + 1 < prec_P.size(); j += 2) {
+                                    const ate_ell_coeffs &c1 = prec_Q[j]->coeffs[idx];
+                                    const ate_ell_coeffs &c2 = prec_Q[j + 1]->coeffs[idx];
+                                    const gt lines = gt::mul_024_by_024(
+                                        c1.ell_0, prec_P[j].PY * c1.ell_VW, prec_P[j].PX * c1.ell_VV, c2.ell_0,
+                                        prec_P[j + 1].PY * c2.ell_VW, prec_P[j + 1].PX * c2.ell_VV);
+                                    f = f_is_one ? lines : f * lines;
+                                    f_is_one = false;
+                                }
+                                if (j < prec_P.size()) {
+                                    const ate_ell_coeffs &c = prec_Q[j]->coeffs[idx];
+                                    f = f.mul_by_024(c.ell_0, prec_P[j].PY * c.ell_VW, prec_P[j].PX * c.ell_VV);
+                                    f_is_one = false;
+                                }
+                            };
+
+                            /* the most significant digit is skipped, R starts at Q */
+                            for (std::size_t i = 1; i < policy_type::ate_loop_count_naf_size; ++i) {
+                                const std::int8_t digit = policy_type::ate_loop_count_naf[i];
+
+                                if (!f_is_one) {
+                                    f = f.squared();
+                                }
+                                mul_by_lines(idx++);
+
+                                if (digit != 0) {
+                                    mul_by_lines(idx++);
+                                }
+                            }
+
+                            if (policy_type::ate_is_loop_count_neg) {
+                                f = f.inversed();
+                            }
+
+                            mul_by_lines(idx++);
+                            mul_by_lines(idx++);
+
+                            return f;
+                        }
+
+                    public:
+                        /* affine ate miller loop */
+
+                        static affine_ate_g1_precomputation affine_ate_precompute_g1(const g1 &P) {
+                            g1 Pcopy = P.to_affine();
+
+                            affine_ate_g1_precomputation result;
+                            result.PX = Pcopy.X;
+                            result.PY = Pcopy.Y;
+
+                            return result;
+                        }
+
+                        /**
+                         * Same lines as ate_precompute_g2, each divided by its ell_VW coefficient. The
+                         * factors lie in Fq2 and vanish in the final exponentiation, so only two Fq2
+                         * coefficients per line are kept and the Miller loop multiplies by yP directly.
+                         */
+                        static affine_ate_g2_precomputation affine_ate_precompute_g2(const g2 &Q) {
+                            const ate_g2_precomp prec_Q = ate_precompute_g2(Q);
+                            BOOST_ASSERT(prec_Q.coeffs.size() == affine_ate_coeffs_num);
+
+                            std::array<Fq2, affine_ate_coeffs_num> ell_VW_inversed;
+                            for (std::size_t i = 0; i < affine_ate_coeffs_num; ++i) {
+                                ell_VW_inversed[i] = prec_Q.coeffs[i].ell_VW;
+                            }
+                            fields::detail::batch_inversion(ell_VW_inversed.begin(), ell_VW_inversed.end());
+
+                            affine_ate_g2_precomputation result;
+                            result.QX = prec_Q.QX;
+                            result.QY = prec_Q.QY;
+                            for (std::size_t i = 0; i < affine_ate_coeffs_num; ++i) {
+                                result.coeffs[i].ell_0 = prec_Q.coeffs[i].ell_0 * ell_VW_inversed[i];
+                                result.coeffs[i].ell_VV = prec_Q.coeffs[i].ell_VV * ell_VW_inversed[i];
+                            }
+
+                            return result;
+                        }
+
+                        static gt affine_ate_miller_loop(const affine_ate_g1_precomputation &prec_P,
+                                                         const affine_ate_g2_precomputation &prec_Q) {
+                            gt f = gt::one();
+
+                            std::size_t idx = 0;
+
+                            /* the most significant digit is skipped, R starts at Q */
+                            for (std::size_t i = 1; i < policy_type::ate_loop_count_naf_size; ++i) {
+                                const std::int8_t digit = policy_type::ate_loop_count_naf[i];
+
+                                const affine_ate_coeffs &c = prec_Q.coeffs[idx++];
+                                f = f.squared().mul_by_024(c.ell_0, prec_P.PY, prec_P.PX * c.ell_VV);
+
+                                if (digit != 0) {
+                                    const affine_ate_coeffs &c = prec_Q.coeffs[idx++];
+                                    f = f.mul_by_024(c.ell_0, prec_P.PY, prec_P.PX * c.ell_VV);
+                                }
+                            }
+
+                            if (policy_type::ate_is_loop_count_neg) {
+                                f = f.inversed();
+                            }
+
+                            for (; idx < affine_ate_coeffs_num; ++idx) {
+                                const affine_ate_coeffs &c = prec_Q.coeffs[idx];
+                                f = f.mul_by_024(c.ell_0, prec_P.PY, prec_P.PX * c.ell_VV);
+                            }
+
+                            return f;
+                        }
+
+                    private:
                         static gt ate_pair(const g1 &P, const g2 &Q) {
                             ate_g1_precomp prec_P = ate_precompute_g1(P);
                             ate_g2_precomp prec_Q = ate_precompute_g2(Q);
@@ -473,6 +655,24 @@ namespace nil {
                             return ate_double_miller_loop(prec_P1, prec_Q1, prec_P2, prec_Q2);
                         }
 
+                        static gt multi_miller_loop(const std::vector<g1_precomp> &prec_P,
+                                                    const std::vector<g2_precomp> &prec_Q) {
+                            std::vector<const g2_precomp *> prec_Q_ptrs;
+                            prec_Q_ptrs.reserve(prec_Q.size());
+                            for (const g2_precomp &prec_Q_i : prec_Q) {
+                                prec_Q_ptrs.emplace_back(&prec_Q_i);
+                            }
+                            return ate_multi_miller_loop(prec_P, prec_Q_ptrs);
+                        }
+
+                        /**
+                         * Same as above, for G2 precomputations owned elsewhere, e.g. by a g2_precomp_cache.
+                         */
+                        static gt multi_miller_loop(const std::vector<g1_precomp> &prec_P,
+                                                    const std::vector<const g2_precomp *> &prec_Q) {
+                            return ate_multi_miller_loop(prec_P, prec_Q);
+                        }
+
                         static gt pair(const g1 &P, const g2 &Q) {
                             return ate_pair(P, Q);
                         }
@@ -480,6 +680,14 @@ namespace nil {
                         static gt pair_reduced(const g1 &P, const g2 &Q) {
                             return ate_pair_reduced(P, Q);
                         }
+
+                        static gt affine_pair_reduced(const g1 &P, const g2 &Q) {
+                            const affine_ate_g1_precomputation prec_P = affine_ate_precompute_g1(P);
+                            const affine_ate_g2_precomputation prec_Q = affine_ate_precompute_g2(Q);
+                            const gt f = affine_ate_miller_loop(prec_P, prec_Q);
+                            const gt result = final_exponentiation(f);
+                            return result;
+                        }
                     };
                 }    // namespace detail
             }        // namespace pairing
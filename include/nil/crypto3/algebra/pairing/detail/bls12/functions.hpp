@@ -26,6 +26,13 @@
 #ifndef CRYPTO3_ALGEBRA_PAIRING_BLS12_FUNCTIONS_HPP
 #define CRYPTO3_ALGEBRA_PAIRING_BLS12_FUNCTIONS_HPP
 
+#include <array>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/algebra/fields/detail/batch_inversion.hpp>
+#include <nil/crypto3/algebra/fields/detail/exponentiation.hpp>
 #include <nil/crypto3/algebra/pairing/detail/bls12/basic_policy.hpp>
 
 #include <nil/crypto3/multiprecision/number.hpp>
@@ -109,10 +116,43 @@ namespace nil {
                         typedef ate_g1_precomp g1_precomp;
                         typedef ate_g2_precomp g2_precomp;
 
+                        /* affine ate precomputation: lines normalized so that ell_VW = 1 */
+
+                        constexpr static const std::size_t affine_ate_coeffs_num =
+                            (policy_type::ate_loop_count_bits - 1) + (policy_type::ate_loop_count_hamming_weight - 1);
+
+                        struct affine_ate_g1_precomputation {
+                            Fq PX;
+                            Fq PY;
+
+                            bool operator==(const affine_ate_g1_precomputation &other) const {
+                                return (this->PX == other.PX && this->PY == other.PY);
+                            }
+                        };
+
+                        struct affine_ate_coeffs {
+                            Fq2 ell_0;
+                            Fq2 ell_VV;
+
+                            bool operator==(const affine_ate_coeffs &other) const {
+                                return (this->ell_0 == other.ell_0 && this->ell_VV == other.ell_VV);
+                            }
+                        };
+
+                        struct affine_ate_g2_precomputation {
+                            Fq2 QX;
+                            Fq2 QY;
+                            std::array<affine_ate_coeffs, affine_ate_coeffs_num> coeffs;
+
+                            bool operator==(const affine_ate_g2_precomputation &other) const {
+                                return (this->QX == other.QX && this->QY == other.QY && this->coeffs == other.coeffs);
+                            }
+                        };
+
                     private:
                         /*************************  FINAL EXPONENTIATIONS  ***********************************/
 
-                        static gt final_exponentiation_first_chunk(const gt &elt) {
+                        static gt final_exponentiation_first_chunk(const gt &elt, const gt &elt_inv) {
 
                             /*
                               Computes result = elt^((q^6-1)*(q^2+1)).
@@ -120,14 +160,14 @@ namespace nil {
                                  elt^((q^6-1)*(q^2+1)) = (conj(elt) * elt^(-1))^(q^2+1)
                               More precisely:
                               A = conj(elt)
-                              B = elt.inversed()
+                              B = elt^(-1)
                               C = A * B
                               D = C.Frobenius_map(2)
                               result = D * C
                             */
 
                             const gt A = elt.unitary_inversed();
-                            const gt B = elt.inversed();
+                            const gt B = elt_inv;
                             const gt C = A * B;
                             const gt D = C.Frobenius_map(2);
                             const gt result = D * C;
@@ -137,7 +177,9 @@ namespace nil {
 
                         static gt exp_by_z(const gt &elt) {
 
-                            gt result = elt.cyclotomic_exp(policy_type::final_exponent_z);
+                            static const fields::detail::cyclotomic_wnaf_exponent z(policy_type::final_exponent_z);
+
+                            gt result = elt.cyclotomic_exp(z);
                             if (policy_type::final_exponent_is_z_neg) {
                                 result = result.unitary_inversed();
                             }
@@ -147,34 +189,35 @@ namespace nil {
 
                         static gt final_exponentiation_last_chunk(const gt &elt) {
 
-                            const gt A = elt.cyclotomic_squared();    // elt^2
-                            const gt B = A.unitary_inversed();        // elt^(-2)
-                            const gt C = exp_by_z(elt);               // elt^z
-                            const gt D = C.cyclotomic_squared();      // elt^(2z)
-                            const gt E = B * C;                       // elt^(z-2)
-                            const gt F = exp_by_z(E);                 // elt^(z^2-2z)
-                            const gt G = exp_by_z(F);                 // elt^(z^3-2z^2)
-                            const gt H = exp_by_z(G);                 // elt^(z^4-2z^3)
-                            const gt I = H * D;                       // elt^(z^4-2z^3+2z)
-                            const gt J = exp_by_z(I);                 // elt^(z^5-2z^4+2z^2)
-                            const gt K = E.unitary_inversed();        // elt^(-z+2)
-                            const gt L = K * J;                       // elt^(z^5-2z^4+2z^2) * elt^(-z+2)
-                            const gt M = elt * L;                     // elt^(z^5-2z^4+2z^2) * elt^(-z+2) * elt
-                            const gt N = elt.unitary_inversed();      // elt^(-1)
-                            const gt O = F * elt;                     // elt^(z^2-2z) * elt
-                            const gt P = O.Frobenius_map(3);          // (elt^(z^2-2z) * elt)^(q^3)
-                            const gt Q = I * N;                       // elt^(z^4-2z^3+2z) * elt^(-1)
-                            const gt R = Q.Frobenius_map(1);          // (elt^(z^4-2z^3+2z) * elt^(-1))^q
-                            const gt S = C * G;                       // elt^(z^3-2z^2) * elt^z
-                            const gt T = S.Frobenius_map(2);          // (elt^(z^3-2z^2) * elt^z)^(q^2)
-                            const gt U = T * P;    // (elt^(z^2-2z) * elt)^(q^3) * (elt^(z^3-2z^2) * elt^z)^(q^2)
-                            const gt V = U * R;    // (elt^(z^2-2z) * elt)^(q^3) * (elt^(z^3-2z^2) * elt^z)^(q^2) *
-                                                   // (elt^(z^4-2z^3+2z) * elt^(-1))^q
-                            const gt W =
-                                V * M;    // (elt^(z^2-2z) * elt)^(q^3) * (elt^(z^3-2z^2) * elt^z)^(q^2) *
-                                          // (elt^(z^4-2z^3+2z) * elt^(-1))^q * elt^(z^5-2z^4+2z^2) * elt^(-z+2) * elt
-
-                            return W;
+                            /*
+                              Follows Hayashida, Hayasaka and Teruya, "Efficient Final Exponentiation via
+                              Cyclotomic Structure for Pairings over Families of Elliptic Curves"
+                              (ePrint 2020/875), by computing
+
+                              result = elt^(3 * (q^4 - q^2 + 1)/r)
+                                     = elt^((z-1)^2 * (z+q) * (z^2+q^2-1) + 3)
+
+                              which is a fixed power of the reduced pairing coprime to r. The chain below
+                              costs five exponentiations by z, seven Fp12 multiplications, one cyclotomic
+                              squaring and two Frobenius maps:
+
+                              A = elt^2
+                              B = exp_by_z(elt) * conj(elt)        // = elt^(z-1)
+                              C = exp_by_z(B) * conj(B)            // = elt^((z-1)^2)
+                              D = exp_by_z(C) * C.Frobenius_map(1) // = elt^((z-1)^2 * (z+q))
+                              E = exp_by_z(exp_by_z(D))            // = D^(z^2)
+                              F = E * D.Frobenius_map(2) * conj(D) // = D^(z^2+q^2-1)
+                              result = F * A * elt
+                            */
+
+                            const gt A = elt.cyclotomic_squared();
+                            const gt B = exp_by_z(elt) * elt.unitary_inversed();
+                            const gt C = exp_by_z(B) * B.unitary_inversed();
+                            const gt D = exp_by_z(C) * C.Frobenius_map(1);
+                            const gt E = exp_by_z(exp_by_z(D));
+                            const gt F = E * D.Frobenius_map(2) * D.unitary_inversed();
+
+                            return F * A * elt;
                         }
 
                     public:
@@ -182,12 +225,38 @@ namespace nil {
                             /* OLD naive version:
                                 gt result = elt^final_exponent;
                             */
-                            gt A = final_exponentiation_first_chunk(elt);
+                            return final_exponentiation(elt, elt.inversed());
+                        }
+
+                        /**
+                         * Same as final_exponentiation(elt), with elt_inv = elt^(-1) supplied by the caller, e.g.
+                         * from a batch inversion.
+                         */
+                        static gt final_exponentiation(const gt &elt, const gt &elt_inv) {
+                            gt A = final_exponentiation_first_chunk(elt, elt_inv);
                             gt result = final_exponentiation_last_chunk(A);
 
                             return result;
                         }
 
+                        /**
+                         * Checks elt^(q^4 + 1) == elt^(q^2), i.e. that elt lies in the cyclotomic subgroup of order
+                         * q^4 - q^2 + 1 where cyclotomic squarings and unitary inversions are valid.
+                         */
+                        static bool cyclotomic_subgroup_check(const gt &elt) {
+                            return elt != gt::zero() && elt.Frobenius_map(4) * elt == elt.Frobenius_map(2);
+                        }
+
+                        /**
+                         * GT membership test from Scott, "A note on group membership tests for G1, G2 and GT on
+                         * BLS pairing-friendly curves" (ePrint 2021/1130). Since q = z mod r and
+                         * gcd(q - z, q^4 - q^2 + 1) = r, a cyclotomic elt lies in GT iff elt^q == elt^z, which costs
+                         * one exponentiation by z instead of one by r.
+                         */
+                        static bool gt_subgroup_check(const gt &elt) {
+                            return cyclotomic_subgroup_check(elt) && elt.Frobenius_map(1) == exp_by_z(elt);
+                        }
+
                     private:
                         /*************************  ATE PAIRING ***********************************/
 
@@ -359,16 +428,77 @@ namespace nil {
 
                                 f = f.squared();
 
-                                f = f.mul_by_045(c1.ell_0, prec_P1.PY * c1.ell_VW, prec_P1.PX * c1.ell_VV);
-                                f = f.mul_by_045(c2.ell_0, prec_P2.PY * c2.ell_VW, prec_P2.PX * c2.ell_VV);
+                                f = f * gt::mul_045_by_045(c1.ell_0, prec_P1.PY * c1.ell_VW, prec_P1.PX * c1.ell_VV,
+                                                           c2.ell_0, prec_P2.PY * c2.ell_VW, prec_P2.PX * c2.ell_VV);
 
                                 if (bit) {
                                     ate_ell_coeffs c1 = prec_Q1.coeffs[idx];
                                     ate_ell_coeffs c2 = prec_Q2.coeffs[idx];
                                     ++idx;
 
-                                    f = f.mul_by_045(c1.ell_0, prec_P1.PY * c1.ell_VW, prec_P1.PX * c1.ell_VV);
-                                    f = f.mul_by_045(c2.ell_0, prec_P2.PY * c2.ell_VW, prec_P2.PX * c2.ell_VV);
+                                    f = f * gt::mul_045_by_045(c1.ell_0, prec_P1.PY * c1.ell_VW,
+                                                               prec_P1.PX * c1.ell_VV, c2.ell_0,
+                                                               prec_P2.PY * c2.ell_VW, prec_P2.PX * c2.ell_VV);
+                                }
+                            }
+
+                            if (policy_type::ate_is_loop_count_neg) {
+                                f = f.inversed();
+                            }
+
+                            return f;
+                        }
+
+                        // n pairs share one chain of squarings of f
+                        static gt ate_multi_miller_loop(const std::vector<ate_g1_precomp> &prec_P,
+                                                        const std::vector<const ate_g2_precomp *> &prec_Q) {
+                            BOOST_ASSERT(prec_P.size() == prec_Q.size());
+
+                            gt f = gt::one();
+                            // set until the first lines are multiplied in, so that the squaring of f and the
+                            // multiplication of one by the first lines can be skipped
+                            bool f_is_one = true;
+
+                            bool found_one = false;
+                            std::size_t idx = 0;
+
+                            const typename policy_type::number_type &loop_count = policy_type::ate_loop_count;
+
+                            /* lines are multiplied together in pairs (sparse by sparse) before one dense
+                               multiplication into f */
+                            auto mul_by_lines = [&prec_P, &prec_Q, &f, &f_is_one](std::size_t idx) {
+                                std::size_t j = 0;
+                                for (; j + 1 < prec_P.size(); j += 2) {
+                                    const ate_ell_coeffs &c1 = prec_Q[j]->coeffs[idx];
+                                    const ate_ell_coeffs &c2 = prec_Q[j + 1]->coeffs[idx];
+                                    const gt lines = gt::mul_045_by_045(
+                                        c1.ell_0, prec_P[j].PY * c1.ell_VW, prec_P[j].PX * c1.ell_VV, c2.ell_0,
+                                        prec_P[j + 1].PY * c2.ell_VW, prec_P[j + 1].PX * c2.ell_VV);
+                                    f = f_is_one ? lines : f * lines;
+                                    f_is_one = false;
+                                }
+                                if (j < prec_P.size()) {
+                                    const ate_ell_coeffs &c = prec_Q[j]->coeffs[idx];
+                                    f = f.mul_by_045(c.ell_0, prec_P[j].PY * c.ell_VW, prec_P[j].PX * c.ell_VV);
+                                    f_is_one = false;
+                                }
+                            };
+
+                            for (long i = policy_type::number_type_max_bits; i >= 0; --i) {
+                                const bool bit = multiprecision::bit_test(loop_count, i);
+                                if (!found_one) {
+                                    /* this skips the MSB itself */
+                                    found_one |= bit;
+                                    continue;
+                                }
+
+                                if (!f_is_one) {
+                                    f = f.squared();
+                                }
+                                mul_by_lines(idx++);
+
+                                if (bit) {
+                                    mul_by_lines(idx++);
                                 }
                             }
 
@@ -379,6 +509,79 @@ namespace nil {
                             return f;
                         }
 
+                    public:
+                        /* affine ate miller loop */
+
+                        static affine_ate_g1_precomputation affine_ate_precompute_g1(const g1 &P) {
+                            g1 Pcopy = P.to_affine();
+
+                            affine_ate_g1_precomputation result;
+                            result.PX = Pcopy.X;
+                            result.PY = Pcopy.Y;
+
+                            return result;
+                        }
+
+                        /**
+                         * Same lines as ate_precompute_g2, each divided by its ell_VW coefficient. The
+                         * factors lie in Fq2 and vanish in the final exponentiation, so only two Fq2
+                         * coefficients per line are kept and the Miller loop multiplies by yP directly.
+                         */
+                        static affine_ate_g2_precomputation affine_ate_precompute_g2(const g2 &Q) {
+                            const ate_g2_precomp prec_Q = ate_precompute_g2(Q);
+                            BOOST_ASSERT(prec_Q.coeffs.size() == affine_ate_coeffs_num);
+
+                            std::array<Fq2, affine_ate_coeffs_num> ell_VW_inversed;
+                            for (std::size_t i = 0; i < affine_ate_coeffs_num; ++i) {
+                                ell_VW_inversed[i] = prec_Q.coeffs[i].ell_VW;
+                            }
+                            fields::detail::batch_inversion(ell_VW_inversed.begin(), ell_VW_inversed.end());
+
+                            affine_ate_g2_precomputation result;
+                            result.QX = prec_Q.QX;
+                            result.QY = prec_Q.QY;
+                            for (std::size_t i = 0; i < affine_ate_coeffs_num; ++i) {
+                                result.coeffs[i].ell_0 = prec_Q.coeffs[i].ell_0 * ell_VW_inversed[i];
+                                result.coeffs[i].ell_VV = prec_Q.coeffs[i].ell_VV * ell_VW_inversed[i];
+                            }
+
+                            return result;
+                        }
+
+                        static gt affine_ate_miller_loop(const affine_ate_g1_precomputation &prec_P,
+                                                         const affine_ate_g2_precomputation &prec_Q) {
+                            gt f = gt::one();
+
+                            bool found_one = false;
+                            std::size_t idx = 0;
+
+                            const typename policy_type::number_type &loop_count = policy_type::ate_loop_count;
+
+                            for (long i = policy_type::number_type_max_bits; i >= 0; --i) {
+                                const bool bit = multiprecision::bit_test(loop_count, i);
+                                if (!found_one) {
+                                    /* this skips the MSB itself */
+                                    found_one |= bit;
+                                    continue;
+                                }
+
+                                const affine_ate_coeffs &c = prec_Q.coeffs[idx++];
+                                f = f.squared().mul_by_045(c.ell_0, prec_P.PY, prec_P.PX * c.ell_VV);
+
+                                if (bit) {
+                                    const affine_ate_coeffs &c = prec_Q.coeffs[idx++];
+                                    f = f.mul_by_045(c.ell_0, prec_P.PY, prec_P.PX * c.ell_VV);
+                                }
+                            }
+
+                            if (policy_type::ate_is_loop_count_neg) {
+                                f = f.inversed();
+                            }
+
+                            return f;
+                        }
+
+                    private:
                         static gt ate_pair(const g1 &P, const g2 &Q) {
                             ate_g1_precomp prec_P = ate_precompute_g1(P);
                             ate_g2_precomp prec_Q = ate_precompute_g2(Q);
@@ -412,6 +615,24 @@ namespace nil {
                             return ate_double_miller_loop(prec_P1, prec_Q1, prec_P2, prec_Q2);
                         }
 
+                        static gt multi_miller_loop(const std::vector<g1_precomp> &prec_P,
+                                                    const std::vector<g2_precomp> &prec_Q) {
+                            std::vector<const g2_precomp *> prec_Q_ptrs;
+                            prec_Q_ptrs.reserve(prec_Q.size());
+                            for (const g2_precomp &prec_Q_i : prec_Q) {
+                                prec_Q_ptrs.emplace_back(&prec_Q_i);
+                            }
+                            return ate_multi_miller_loop(prec_P, prec_Q_ptrs);
+                        }
+
+                        /**
+                         * Same as above, for G2 precomputations owned elsewhere, e.g. by a g2_precomp_cache.
+                         */
+                        static gt multi_miller_loop(const std::vector<g1_precomp> &prec_P,
+                                                    const std::vector<const g2_precomp *> &prec_Q) {
+                            return ate_multi_miller_loop(prec_P, prec_Q);
+                        }
+
                         static gt pair(const g1 &P, const g2 &Q) {
                             return ate_pair(P, Q);
                         }
@@ -419,6 +640,14 @@ namespace nil {
                         static gt pair_reduced(const g1 &P, const g2 &Q) {
                             return ate_pair_reduced(P, Q);
                         }
+
+                        static gt affine_pair_reduced(const g1 &P, const g2 &Q) {
+                            const affine_ate_g1_precomputation prec_P = affine_ate_precompute_g1(P);
+                            const affine_ate_g2_precomputation prec_Q = affine_ate_precompute_g2(Q);
+                            const gt f = affine_ate_miller_loop(prec_P, prec_Q);
+                            const gt result = final_exponentiation(f);
+                            return result;
+                        }
                     };
                 }    // namespace detail
             }        // namespace pairing
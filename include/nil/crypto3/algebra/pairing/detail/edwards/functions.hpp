@@ -26,6 +26,11 @@
 #ifndef CRYPTO3_ALGEBRA_PAIRING_EDWARDS_FUNCTIONS_HPP
 #define CRYPTO3_ALGEBRA_PAIRING_EDWARDS_FUNCTIONS_HPP
 
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/algebra/fields/detail/exponentiation.hpp>
 #include <nil/crypto3/algebra/pairing/detail/edwards/basic_policy.hpp>
 
 #include <nil/crypto3/multiprecision/number.hpp>
@@ -127,15 +132,20 @@ namespace nil {
 
                         static gt final_exponentiation_last_chunk(const gt &elt, const gt &elt_inv) {
 
+                            static const fields::detail::cyclotomic_wnaf_exponent w1(
+                                policy_type::final_exponent_last_chunk_w1);
+                            static const fields::detail::cyclotomic_wnaf_exponent abs_of_w0(
+                                policy_type::final_exponent_last_chunk_abs_of_w0);
+
                             const gt elt_q = elt.Frobenius_map(1);
 
-                            gt w1_part = elt_q.cyclotomic_exp(policy_type::final_exponent_last_chunk_w1);
+                            gt w1_part = elt_q.cyclotomic_exp(w1);
                             gt w0_part = gt::zero();
 
                             if (policy_type::final_exponent_last_chunk_is_w0_neg) {
-                                w0_part = elt_inv.cyclotomic_exp(policy_type::final_exponent_last_chunk_abs_of_w0);
+                                w0_part = elt_inv.cyclotomic_exp(abs_of_w0);
                             } else {
-                                w0_part = elt.cyclotomic_exp(policy_type::final_exponent_last_chunk_abs_of_w0);
+                                w0_part = elt.cyclotomic_exp(abs_of_w0);
                             }
 
                             return w1_part * w0_part;
@@ -159,7 +169,14 @@ namespace nil {
 
                     public:
                         static gt final_exponentiation(const gt &elt) {
-                            const gt elt_inv = elt.inversed();
+                            return final_exponentiation(elt, elt.inversed());
+                        }
+
+                        /**
+                         * Same as final_exponentiation(elt), with elt_inv = elt^(-1) supplied by the caller, e.g.
+                         * from a batch inversion.
+                         */
+                        static gt final_exponentiation(const gt &elt, const gt &elt_inv) {
                             const gt elt_to_first_chunk = final_exponentiation_first_chunk(elt, elt_inv);
                             const gt elt_inv_to_first_chunk = final_exponentiation_first_chunk(elt_inv, elt);
                             return final_exponentiation_last_chunk(elt_to_first_chunk, elt_inv_to_first_chunk);
@@ -598,6 +615,46 @@ namespace nil {
                             return f;
                         }
 
+                        // n pairs share one chain of squarings of f
+                        static gt ate_multi_miller_loop(const std::vector<ate_g1_precomp> &prec_P,
+                                                        const std::vector<const ate_g2_precomp *> &prec_Q) {
+                            BOOST_ASSERT(prec_P.size() == prec_Q.size());
+
+                            const typename policy_type::number_type &loop_count = policy_type::ate_loop_count;
+
+                            gt f = gt::one();
+
+                            bool found_one = false;
+                            std::size_t idx = 0;
+                            for (long i = number_type_max_bits - 1; i >= 0; --i) {
+                                const bool bit = nil::crypto3::multiprecision::bit_test(loop_count, i);
+                                if (!found_one) {
+                                    /* this skips the MSB itself */
+                                    found_one |= bit;
+                                    continue;
+                                }
+
+                                f = f.squared();
+                                for (std::size_t j = 0; j < prec_P.size(); ++j) {
+                                    const Fq3_conic_coefficients &cc = (*prec_Q[j])[idx];
+                                    f = f * gt(prec_P[j].P_XY * cc.c_XY + prec_P[j].P_XZ * cc.c_XZ,
+                                               prec_P[j].P_ZZplusYZ * cc.c_ZZ);
+                                }
+                                ++idx;
+
+                                if (bit) {
+                                    for (std::size_t j = 0; j < prec_P.size(); ++j) {
+                                        const Fq3_conic_coefficients &cc = (*prec_Q[j])[idx];
+                                        f = f * gt(prec_P[j].P_ZZplusYZ * cc.c_ZZ,
+                                                   prec_P[j].P_XY * cc.c_XY + prec_P[j].P_XZ * cc.c_XZ);
+                                    }
+                                    ++idx;
+                                }
+                            }
+
+                            return f;
+                        }
+
                         static gt ate_pair(const g1 &P, const g2 &Q) {
                             ate_g1_precomp prec_P = ate_precompute_g1(P);
                             ate_g2_precomp prec_Q = ate_precompute_g2(Q);
@@ -634,6 +691,24 @@ namespace nil {
                             return ate_double_miller_loop(prec_P1, prec_Q1, prec_P2, prec_Q2);
                         }
 
+                        static gt multi_miller_loop(const std::vector<g1_precomp> &prec_P,
+                                                    const std::vector<g2_precomp> &prec_Q) {
+                            std::vector<const g2_precomp *> prec_Q_ptrs;
+                            prec_Q_ptrs.reserve(prec_Q.size());
+                            for (const g2_precomp &prec_Q_i : prec_Q) {
+                                prec_Q_ptrs.emplace_back(&prec_Q_i);
+                            }
+                            return ate_multi_miller_loop(prec_P, prec_Q_ptrs);
+                        }
+
+                        /**
+                         * Same as above, for G2 precomputations owned elsewhere, e.g. by a g2_precomp_cache.
+                         */
+                        static gt multi_miller_loop(const std::vector<g1_precomp> &prec_P,
+                                                    const std::vector<const g2_precomp *> &prec_Q) {
+                            return ate_multi_miller_loop(prec_P, prec_Q);
+                        }
+
                         static gt pair(const g1 &P, const g2 &Q) {
                             return ate_pair(P, Q);
                         }
@@ -26,6 +26,9 @@
 #ifndef CRYPTO3_ALGEBRA_PAIRING_MNT4_BASIC_POLICY_HPP
 #define CRYPTO3_ALGEBRA_PAIRING_MNT4_BASIC_POLICY_HPP
 
+#include <array>
+#include <cstdint>
+
 #include <nil/crypto3/algebra/curves/detail/mnt4/basic_policy.hpp>
 #include <nil/crypto3/algebra/curves/detail/mnt4/g1.hpp>
 #include <nil/crypto3/algebra/curves/detail/mnt4/g2.hpp>
@@ -65,6 +68,16 @@ namespace nil {
 
                         constexpr static const number_type ate_loop_count =
                             0x1EEF5546609756BEC2A33F0DC9A1B671660000_cppui149;
+                        /* ate_loop_count in non-adjacent form, most significant digit first (affine ate loop) */
+                        constexpr static const std::size_t ate_loop_count_naf_size = 150;
+                        constexpr static const std::size_t ate_loop_count_naf_weight = 48;
+                        constexpr static const std::array<std::int8_t, ate_loop_count_naf_size> ate_loop_count_naf = {
+                            1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 0, 1, 0, -1,
+                            0, 1, 0, -1, 0, 0, 0, 0, 0, 1, 0, 1, 0, -1, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, -1, 0, -1, 0,
+                            0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 1, 0, -1, 0, 1, 0, 0, 0, 0, 0, -1,
+                            0, 0, 0, 1, 0, 0, -1, 0, 0, -1, 0, 0, 1, 0, 1, 0, -1, 0, 1, 0, 0, 0, 1, 0, 0, -1, 0, 0, -1,
+                            0, -1, 0, 1, 0, 0, -1, 0, 0, 1, 0, -1, 0, -1, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                            0, 0, 0, 0, 0, 0};
                         constexpr static const bool ate_is_loop_count_neg = false;
                         constexpr static const extended_number_type final_exponent = extended_number_type(
                             0x343C7AC3174C87A1EFE216B37AFB6D3035ACCA5A07B2394F42E0029264C0324A95E87DCB6C97234CBA7385B8D20FEA4E85074066818687634E61F58B68EA590B11CEE431BE8348DEB351384D8485E987A57004BB9A1E7A6036C7A5801F55AC8E065E41B012422619E7E69541C5980000_cppui894);
@@ -83,6 +96,9 @@ namespace nil {
                     constexpr typename mnt4_basic_policy<298>::extended_number_type const
                         mnt4_basic_policy<298>::final_exponent;
 
+                    constexpr std::array<std::int8_t, mnt4_basic_policy<298>::ate_loop_count_naf_size> const
+                        mnt4_basic_policy<298>::ate_loop_count_naf;
+
                     constexpr bool const mnt4_basic_policy<298>::ate_is_loop_count_neg;
                     constexpr bool const mnt4_basic_policy<298>::final_exponent_last_chunk_is_w0_neg;
                 }    // namespace detail
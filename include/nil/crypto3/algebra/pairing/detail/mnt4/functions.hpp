@@ -26,11 +26,16 @@
 #ifndef CRYPTO3_ALGEBRA_PAIRING_MNT4_FUNCTIONS_HPP
 #define CRYPTO3_ALGEBRA_PAIRING_MNT4_FUNCTIONS_HPP
 
+#include <cstdint>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/algebra/fields/detail/exponentiation.hpp>
 #include <nil/crypto3/algebra/pairing/detail/mnt4/basic_policy.hpp>
 
 #include <nil/crypto3/multiprecision/number.hpp>
 #include <nil/crypto3/multiprecision/cpp_int.hpp>
-#include <nil/crypto3/multiprecision/wnaf.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -163,13 +168,18 @@ namespace nil {
 
                         static gt final_exponentiation_last_chunk(const gt &elt, const gt &elt_inv) {
 
+                            static const fields::detail::cyclotomic_wnaf_exponent w1(
+                                policy_type::final_exponent_last_chunk_w1);
+                            static const fields::detail::cyclotomic_wnaf_exponent abs_of_w0(
+                                policy_type::final_exponent_last_chunk_abs_of_w0);
+
                             const gt elt_q = elt.Frobenius_map(1);
-                            gt w1_part = elt_q.cyclotomic_exp(policy_type::final_exponent_last_chunk_w1);
+                            gt w1_part = elt_q.cyclotomic_exp(w1);
                             gt w0_part;
                             if (policy_type::final_exponent_last_chunk_is_w0_neg) {
-                                w0_part = elt_inv.cyclotomic_exp(policy_type::final_exponent_last_chunk_abs_of_w0);
+                                w0_part = elt_inv.cyclotomic_exp(abs_of_w0);
                             } else {
-                                w0_part = elt.cyclotomic_exp(policy_type::final_exponent_last_chunk_abs_of_w0);
+                                w0_part = elt.cyclotomic_exp(abs_of_w0);
                             }
                             gt result = w1_part * w0_part;
 
@@ -190,8 +200,14 @@ namespace nil {
 
                     public:
                         static gt final_exponentiation(const gt &elt) {
+                            return final_exponentiation(elt, elt.inversed());
+                        }
 
-                            const gt elt_inv = elt.inversed();
+                        /**
+                         * Same as final_exponentiation(elt), with elt_inv = elt^(-1) supplied by the caller, e.g.
+                         * from a batch inversion.
+                         */
+                        static gt final_exponentiation(const gt &elt, const gt &elt_inv) {
                             const gt elt_to_first_chunk = final_exponentiation_first_chunk(elt, elt_inv);
                             const gt elt_inv_to_first_chunk = final_exponentiation_first_chunk(elt_inv, elt);
                             gt result = final_exponentiation_last_chunk(elt_to_first_chunk, elt_inv_to_first_chunk);
@@ -223,16 +239,9 @@ namespace nil {
 
                             Fq2 RX = Qcopy.X;
                             Fq2 RY = Qcopy.Y;
-                            bool found_nonzero = false;
-
-                            std::vector<long> NAF = multiprecision::find_wnaf(1, policy_type::ate_loop_count);
-
-                            for (long i = NAF.size() - 1; i >= 0; --i) {
-                                if (!found_nonzero) {
-                                    /* this skips the MSB itself */
-                                    found_nonzero |= (NAF[i] != 0);
-                                    continue;
-                                }
+                            /* the most significant digit is skipped, R starts at Q */
+                            for (std::size_t i = 1; i < policy_type::ate_loop_count_naf_size; ++i) {
+                                const std::int8_t digit = policy_type::ate_loop_count_naf[i];
 
                                 affine_ate_coeffs c;
                                 c.old_RX = RX;
@@ -248,11 +257,11 @@ namespace nil {
                                 RX = c.gamma.squared() - (c.old_RX + c.old_RX);
                                 RY = c.gamma * (c.old_RX - RX) - c.old_RY;
 
-                                if (NAF[i] != 0) {
+                                if (digit != 0) {
                                     affine_ate_coeffs c;
                                     c.old_RX = RX;
                                     c.old_RY = RY;
-                                    if (NAF[i] > 0) {
+                                    if (digit > 0) {
                                         c.gamma = (c.old_RY - result.QY) * (c.old_RX - result.QX).inversed();
                                     } else {
                                         c.gamma = (c.old_RY + result.QY) * (c.old_RX - result.QX).inversed();
@@ -275,31 +284,22 @@ namespace nil {
 
                             gt f = gt::one();
 
-                            bool found_nonzero = false;
                             std::size_t idx = 0;
 
-                            std::vector<long> NAF = multiprecision::find_wnaf(1, policy_type::ate_loop_count);
+                            /* the most significant digit is skipped, R starts at Q */
+                            for (std::size_t i = 1; i < policy_type::ate_loop_count_naf_size; ++i) {
+                                const std::int8_t digit = policy_type::ate_loop_count_naf[i];
 
-                            for (long i = NAF.size() - 1; i >= 0; --i) {
-                                if (!found_nonzero) {
-                                    /* this skips the MSB itself */
-                                    found_nonzero |= (NAF[i] != 0);
-                                    continue;
-                                }
-
-                                /* code below gets executed for all bits (EXCEPT the MSB itself) of
-                                   param_p (skipping leading zeros) in MSB to LSB
-                                   order */
                                 affine_ate_coeffs c = prec_Q.coeffs[idx++];
 
                                 gt g_RR_at_P =
                                     gt(prec_P.PY_twist_squared, -prec_P.PX * c.gamma_twist + c.gamma_X - c.old_RY);
                                 f = f.squared().mul_by_023(g_RR_at_P);
 
-                                if (NAF[i] != 0) {
+                                if (digit != 0) {
                                     affine_ate_coeffs c = prec_Q.coeffs[idx++];
                                     gt g_RQ_at_P;
-                                    if (NAF[i] > 0) {
+                                    if (digit > 0) {
                                         g_RQ_at_P = gt(prec_P.PY_twist_squared,
                                                        -prec_P.PX * c.gamma_twist + c.gamma_X - prec_Q.QY);
                                     } else {
@@ -385,6 +385,11 @@ namespace nil {
                             return result;
                         }
 
+                        /*
+                          The projective precomputation and Miller loops keep the binary schedule of
+                          ate_loop_count: their unreduced outputs are pinned by the pairing test vectors.
+                          Only the affine ate loop walks ate_loop_count_naf.
+                        */
                         static ate_g2_precomp ate_precompute_g2(const g2 &Q) {
 
                             g2 Qcopy = Q.to_affine();
@@ -549,6 +554,61 @@ namespace nil {
                             return f;
                         }
 
+                        // n pairs share one chain of squarings of f
+                        static gt ate_multi_miller_loop(const std::vector<ate_g1_precomp> &prec_P,
+                                                        const std::vector<const ate_g2_precomp *> &prec_Q) {
+                            BOOST_ASSERT(prec_P.size() == prec_Q.size());
+
+                            std::vector<Fq2> L1_coeffs;
+                            L1_coeffs.reserve(prec_P.size());
+                            for (std::size_t j = 0; j < prec_P.size(); ++j) {
+                                L1_coeffs.emplace_back(Fq2(prec_P[j].PX, Fq::zero()) - prec_Q[j]->QX_over_twist);
+                            }
+
+                            gt f = gt::one();
+
+                            bool found_one = false;
+                            std::size_t dbl_idx = 0;
+                            std::size_t add_idx = 0;
+
+                            auto mul_by_add_lines = [&prec_P, &prec_Q, &L1_coeffs, &f](std::size_t idx) {
+                                for (std::size_t j = 0; j < prec_P.size(); ++j) {
+                                    const ate_add_coeffs &ac = prec_Q[j]->add_coeffs[idx];
+                                    f = f * gt(ac.c_RZ * prec_P[j].PY_twist,
+                                               -(prec_Q[j]->QY_over_twist * ac.c_RZ + L1_coeffs[j] * ac.c_L1));
+                                }
+                            };
+
+                            for (long i = policy_type::number_type_max_bits - 1; i >= 0; --i) {
+                                const bool bit = multiprecision::bit_test(policy_type::ate_loop_count, i);
+
+                                if (!found_one) {
+                                    /* this skips the MSB itself */
+                                    found_one |= bit;
+                                    continue;
+                                }
+
+                                f = f.squared();
+                                for (std::size_t j = 0; j < prec_P.size(); ++j) {
+                                    const ate_dbl_coeffs &dc = prec_Q[j]->dbl_coeffs[dbl_idx];
+                                    f = f * gt(-dc.c_4C - dc.c_J * prec_P[j].PX_twist + dc.c_L,
+                                               dc.c_H * prec_P[j].PY_twist);
+                                }
+                                ++dbl_idx;
+
+                                if (bit) {
+                                    mul_by_add_lines(add_idx++);
+                                }
+                            }
+
+                            if (policy_type::ate_is_loop_count_neg) {
+                                mul_by_add_lines(add_idx++);
+                                f = f.inversed();
+                            }
+
+                            return f;
+                        }
+
                         static gt ate_pair(const g1 &P, const g2 &Q) {
 
                             ate_g1_precomp prec_P = ate_precompute_g1(P);
@@ -584,6 +644,24 @@ namespace nil {
                             return ate_double_miller_loop(prec_P1, prec_Q1, prec_P2, prec_Q2);
                         }
 
+                        static gt multi_miller_loop(const std::vector<g1_precomp> &prec_P,
+                                                    const std::vector<g2_precomp> &prec_Q) {
+                            std::vector<const g2_precomp *> prec_Q_ptrs;
+                            prec_Q_ptrs.reserve(prec_Q.size());
+                            for (const g2_precomp &prec_Q_i : prec_Q) {
+                                prec_Q_ptrs.emplace_back(&prec_Q_i);
+                            }
+                            return ate_multi_miller_loop(prec_P, prec_Q_ptrs);
+                        }
+
+                        /**
+                         * Same as above, for G2 precomputations owned elsewhere, e.g. by a g2_precomp_cache.
+                         */
+                        static gt multi_miller_loop(const std::vector<g1_precomp> &prec_P,
+                                                    const std::vector<const g2_precomp *> &prec_Q) {
+                            return ate_multi_miller_loop(prec_P, prec_Q);
+                        }
+
                         static gt pair(const g1 &P, const g2 &Q) {
                             return ate_pair(P, Q);
                         }
@@ -26,6 +26,9 @@
 #ifndef CRYPTO3_ALGEBRA_PAIRING_MNT6_BASIC_POLICY_HPP
 #define CRYPTO3_ALGEBRA_PAIRING_MNT6_BASIC_POLICY_HPP
 
+#include <array>
+#include <cstdint>
+
 #include <nil/crypto3/algebra/curves/detail/mnt6/g1.hpp>
 #include <nil/crypto3/algebra/curves/detail/mnt6/g2.hpp>
 
@@ -64,6 +67,16 @@ namespace nil {
 
                         constexpr static const number_type ate_loop_count =
                             0x1EEF5546609756BEC2A33F0DC9A1B671660000_cppui149;
+                        /* ate_loop_count in non-adjacent form, most significant digit first (affine ate loop) */
+                        constexpr static const std::size_t ate_loop_count_naf_size = 150;
+                        constexpr static const std::size_t ate_loop_count_naf_weight = 48;
+                        constexpr static const std::array<std::int8_t, ate_loop_count_naf_size> ate_loop_count_naf = {
+                            1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 0, 1, 0, -1,
+                            0, 1, 0, -1, 0, 0, 0, 0, 0, 1, 0, 1, 0, -1, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, -1, 0, -1, 0,
+                            0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 1, 0, -1, 0, 1, 0, 0, 0, 0, 0, -1,
+                            0, 0, 0, 1, 0, 0, -1, 0, 0, -1, 0, 0, 1, 0, 1, 0, -1, 0, 1, 0, 0, 0, 1, 0, 0, -1, 0, 0, -1,
+                            0, -1, 0, 1, 0, 0, -1, 0, 0, 1, 0, -1, 0, -1, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                            0, 0, 0, 0, 0, 0};
                         constexpr static const bool ate_is_loop_count_neg = true;
                         constexpr static const extended_number_type final_exponent = extended_number_type(
                             0x2D9F068E10293574745C62CB0EE7CF1D27F98BA7E8F16BB1CB498038B1B0B4D7EA28C42575093726D5E360818F2DD5B39038CFF6405359561DD2F2F0627F9264724E069A7198C17873F7F54D8C7CE3D5DAED1AC5E87C26C03B1F481813BB668B6FEDC7C2AAA83936D8BC842F74C66E7A13921F7D91474B3981D3A3B3B40537720C84FE27E3E90BB29DB12DFFE17A286C150EF5071B3087765F9454046ECBDD3B014FF91A1C18D55DB868E841DBF82BCCEFB4233833BD800000000_cppui1490);
@@ -82,6 +95,9 @@ namespace nil {
                     constexpr typename mnt6_basic_policy<298>::extended_number_type const
                         mnt6_basic_policy<298>::final_exponent;
 
+                    constexpr std::array<std::int8_t, mnt6_basic_policy<298>::ate_loop_count_naf_size> const
+                        mnt6_basic_policy<298>::ate_loop_count_naf;
+
                     constexpr bool const mnt6_basic_policy<298>::ate_is_loop_count_neg;
                     constexpr bool const mnt6_basic_policy<298>::final_exponent_last_chunk_is_w0_neg;
                 }    // namespace detail
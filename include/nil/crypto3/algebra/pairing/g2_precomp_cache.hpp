@@ -0,0 +1,154 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_PAIRING_G2_PRECOMP_CACHE_HPP
+#define CRYPTO3_ALGEBRA_PAIRING_G2_PRECOMP_CACHE_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/algebra/multiexp/detail/point_codec.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace pairing {
+
+                /**
+                 * Bounded, thread-safe cache of G2 precomputations for workloads that pair against the same
+                 * G2 points over and over, e.g. public keys in BLS signature verification. Entries are keyed
+                 * by the affine encoding of the point, so different projective representatives share one entry,
+                 * and the least recently used entry is evicted once capacity is reached.
+                 *
+                 * Precomputations are made outside of the lock; two threads missing on the same point at the
+                 * same time both compute it and the first one to finish wins.
+                 */
+                template<typename CurveType>
+                class g2_precomp_cache {
+                public:
+                    typedef typename CurveType::pairing pairing_policy;
+                    typedef typename pairing_policy::g2_type g2_type;
+                    typedef typename g2_type::value_type g2_value_type;
+                    typedef typename pairing_policy::g2_precomp g2_precomp;
+
+                    explicit g2_precomp_cache(std::size_t capacity) :
+                        max_entries(capacity), hits_count(0), misses_count(0) {
+                        BOOST_ASSERT(capacity > 0);
+                    }
+
+                    g2_precomp_cache(const g2_precomp_cache &) = delete;
+                    g2_precomp_cache &operator=(const g2_precomp_cache &) = delete;
+
+                    /**
+                     * Returns the precomputation of Q, making it on a miss. The returned object stays valid after
+                     * the entry is evicted.
+                     */
+                    std::shared_ptr<const g2_precomp> get(const g2_value_type &Q) {
+                        const key_type key = make_key(Q);
+
+                        {
+                            std::lock_guard<std::mutex> lock(entries_mutex);
+                            typename index_type::iterator it = index.find(key);
+                            if (it != index.end()) {
+                                ++hits_count;
+                                entries.splice(entries.begin(), entries, it->second);
+                                return it->second->second;
+                            }
+                        }
+
+                        ++misses_count;
+                        std::shared_ptr<const g2_precomp> prec_Q =
+                            std::make_shared<const g2_precomp>(pairing_policy::precompute_g2(Q));
+
+                        std::lock_guard<std::mutex> lock(entries_mutex);
+                        typename index_type::iterator it = index.find(key);
+                        if (it != index.end()) {
+                            entries.splice(entries.begin(), entries, it->second);
+                            return it->second->second;
+                        }
+
+                        entries.emplace_front(key, prec_Q);
+                        index.emplace(key, entries.begin());
+                        if (entries.size() > max_entries) {
+                            index.erase(entries.back().first);
+                            entries.pop_back();
+                        }
+
+                        return prec_Q;
+                    }
+
+                    std::size_t hits() const {
+                        return hits_count;
+                    }
+
+                    std::size_t misses() const {
+                        return misses_count;
+                    }
+
+                    std::size_t size() const {
+                        std::lock_guard<std::mutex> lock(entries_mutex);
+                        return entries.size();
+                    }
+
+                    void clear() {
+                        std::lock_guard<std::mutex> lock(entries_mutex);
+                        index.clear();
+                        entries.clear();
+                    }
+
+                private:
+                    typedef algebra::detail::affine_point_codec<g2_type> point_codec;
+                    typedef std::string key_type;
+                    typedef std::list<std::pair<key_type, std::shared_ptr<const g2_precomp>>> entries_type;
+                    typedef std::unordered_map<key_type, typename entries_type::iterator> index_type;
+
+                    static key_type make_key(const g2_value_type &Q) {
+                        std::uint8_t encoded[point_codec::octets_num];
+                        point_codec::encode(Q.to_affine(), encoded);
+                        return key_type(encoded, encoded + point_codec::octets_num);
+                    }
+
+                    const std::size_t max_entries;
+                    std::atomic<std::size_t> hits_count;
+                    std::atomic<std::size_t> misses_count;
+
+                    mutable std::mutex entries_mutex;
+                    // most recently used first
+                    entries_type entries;
+                    index_type index;
+                };
+            }    // namespace pairing
+        }        // namespace algebra
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_PAIRING_G2_PRECOMP_CACHE_HPP
@@ -0,0 +1,500 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_PAIRING_G2_PRECOMP_CODEC_HPP
+#define CRYPTO3_ALGEBRA_PAIRING_G2_PRECOMP_CODEC_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include <nil/crypto3/algebra/marshalling.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+
+                template<std::size_t Version>
+                struct bls12;
+
+                template<std::size_t Version>
+                struct alt_bn128;
+
+                template<std::size_t Version>
+                struct mnt4;
+
+                template<std::size_t Version>
+                struct mnt6;
+
+            }    // namespace curves
+            namespace pairing {
+                namespace detail {
+
+                    /**
+                     * 64-bit FNV-1a, used to detect truncated or corrupted precomputation files. It is not meant to
+                     * protect against deliberate tampering.
+                     */
+                    inline std::uint64_t precomp_checksum(const std::uint8_t *first, const std::uint8_t *last) {
+                        std::uint64_t hash = 0xcbf29ce484222325ULL;
+                        for (; first != last; ++first) {
+                            hash ^= *first;
+                            hash *= 0x100000001b3ULL;
+                        }
+                        return hash;
+                    }
+
+                    template<typename FieldType>
+                    struct precomp_element_writer {
+                        typedef nil::marshalling::field_bincode<FieldType> element_bincode;
+
+                        void operator()(const typename FieldType::value_type &element) {
+                            element_bincode::field_element_to_bytes(element, p, p + element_bincode::field_octets_num);
+                            p += element_bincode::field_octets_num;
+                        }
+
+                        std::uint8_t *p;
+                    };
+
+                    template<typename FieldType>
+                    struct precomp_element_reader {
+                        typedef nil::marshalling::field_bincode<FieldType> element_bincode;
+
+                        typename FieldType::value_type operator()() {
+                            std::pair<bool, typename FieldType::value_type> element =
+                                element_bincode::field_element_from_bytes(p, p + element_bincode::field_octets_num);
+                            p += element_bincode::field_octets_num;
+                            valid = valid && element.first;
+                            return element.second;
+                        }
+
+                        const std::uint8_t *p;
+                        bool valid;
+                    };
+
+                    /**
+                     * Order of the twist field elements of the BLS12 and BN precomputations: QX, QY, then the
+                     * (ell_0, ell_VW, ell_VV) lines of ate_precompute_g2 or the (ell_0, ell_VV) lines of
+                     * affine_ate_precompute_g2.
+                     */
+                    template<typename PairingPolicy>
+                    struct ell_coeffs_precomp_layout {
+                        typedef typename PairingPolicy::g2_precomp g2_precomp;
+                        typedef typename PairingPolicy::affine_ate_g2_precomp affine_ate_g2_precomp;
+
+                        constexpr static std::uint64_t kind(const g2_precomp *) {
+                            return 1;
+                        }
+
+                        constexpr static std::uint64_t kind(const affine_ate_g2_precomp *) {
+                            return 2;
+                        }
+
+                        static std::uint64_t elements_num(std::uint64_t n0, std::uint64_t, const g2_precomp *) {
+                            return 2 + 3 * n0;
+                        }
+
+                        static std::uint64_t elements_num(std::uint64_t n0, std::uint64_t,
+                                                          const affine_ate_g2_precomp *) {
+                            return 2 + 2 * n0;
+                        }
+
+                        template<typename Precomp>
+                        static void counts(const Precomp &prec_Q, std::uint64_t &n0, std::uint64_t &n1) {
+                            n0 = prec_Q.coeffs.size();
+                            n1 = 0;
+                        }
+
+                        /**
+                         * Number of line coefficients of ate_precompute_g2. It depends only on the loop schedule of
+                         * the curve, so it is taken once from the precomputation of the generator.
+                         */
+                        static std::uint64_t expected_coeffs_num() {
+                            static const std::uint64_t coeffs_num =
+                                PairingPolicy::precompute_g2(PairingPolicy::g2_type::value_type::one()).coeffs.size();
+                            return coeffs_num;
+                        }
+
+                        template<typename Writer>
+                        static void write(const g2_precomp &prec_Q, Writer &out) {
+                            out(prec_Q.QX);
+                            out(prec_Q.QY);
+                            for (const auto &c : prec_Q.coeffs) {
+                                out(c.ell_0);
+                                out(c.ell_VW);
+                                out(c.ell_VV);
+                            }
+                        }
+
+                        template<typename Writer>
+                        static void write(const affine_ate_g2_precomp &prec_Q, Writer &out) {
+                            out(prec_Q.QX);
+                            out(prec_Q.QY);
+                            for (const auto &c : prec_Q.coeffs) {
+                                out(c.ell_0);
+                                out(c.ell_VV);
+                            }
+                        }
+
+                        template<typename Reader>
+                        static bool read(Reader &in, std::uint64_t n0, std::uint64_t n1, g2_precomp &prec_Q) {
+                            if (n0 != expected_coeffs_num() || n1 != 0) {
+                                return false;
+                            }
+                            prec_Q.QX = in();
+                            prec_Q.QY = in();
+                            prec_Q.coeffs.resize(n0);
+                            for (auto &c : prec_Q.coeffs) {
+                                c.ell_0 = in();
+                                c.ell_VW = in();
+                                c.ell_VV = in();
+                            }
+                            return true;
+                        }
+
+                        template<typename Reader>
+                        static bool read(Reader &in, std::uint64_t n0, std::uint64_t n1,
+                                         affine_ate_g2_precomp &prec_Q) {
+                            if (n0 != prec_Q.coeffs.size() || n1 != 0) {
+                                return false;
+                            }
+                            prec_Q.QX = in();
+                            prec_Q.QY = in();
+                            for (auto &c : prec_Q.coeffs) {
+                                c.ell_0 = in();
+                                c.ell_VV = in();
+                            }
+                            return true;
+                        }
+                    };
+
+                    /**
+                     * Order of the twist field elements of the MNT precomputations: QX, QY, QY2, QX_over_twist,
+                     * QY_over_twist, the doubling and then the addition coefficients of ate_precompute_g2, or QX, QY
+                     * and the (old_RX, old_RY, gamma, gamma_twist, gamma_X) steps of affine_ate_precompute_g2.
+                     */
+                    template<typename PairingPolicy>
+                    struct mnt_precomp_layout {
+                        typedef typename PairingPolicy::g2_precomp g2_precomp;
+                        typedef typename PairingPolicy::affine_ate_g2_precomp affine_ate_g2_precomp;
+
+                        constexpr static std::uint64_t kind(const g2_precomp *) {
+                            return 3;
+                        }
+
+                        constexpr static std::uint64_t kind(const affine_ate_g2_precomp *) {
+                            return 4;
+                        }
+
+                        static std::uint64_t elements_num(std::uint64_t n0, std::uint64_t n1, const g2_precomp *) {
+                            return 5 + 4 * n0 + 2 * n1;
+                        }
+
+                        static std::uint64_t elements_num(std::uint64_t n0, std::uint64_t,
+                                                          const affine_ate_g2_precomp *) {
+                            return 2 + 5 * n0;
+                        }
+
+                        static void counts(const g2_precomp &prec_Q, std::uint64_t &n0, std::uint64_t &n1) {
+                            n0 = prec_Q.dbl_coeffs.size();
+                            n1 = prec_Q.add_coeffs.size();
+                        }
+
+                        static void counts(const affine_ate_g2_precomp &prec_Q, std::uint64_t &n0,
+                                           std::uint64_t &n1) {
+                            n0 = prec_Q.coeffs.size();
+                            n1 = 0;
+                        }
+
+                        /**
+                         * Coefficient counts of ate_precompute_g2 and affine_ate_precompute_g2. They depend only on
+                         * the loop schedule of the curve, so they are taken once from the precomputations of the
+                         * generator.
+                         */
+                        static void expected_counts(const g2_precomp *, std::uint64_t &n0, std::uint64_t &n1) {
+                            static const g2_precomp prec_one =
+                                PairingPolicy::precompute_g2(PairingPolicy::g2_type::value_type::one());
+                            counts(prec_one, n0, n1);
+                        }
+
+                        static void expected_counts(const affine_ate_g2_precomp *, std::uint64_t &n0,
+                                                    std::uint64_t &n1) {
+                            static const affine_ate_g2_precomp prec_one =
+                                PairingPolicy::affine_ate_precompute_g2(PairingPolicy::g2_type::value_type::one());
+                            counts(prec_one, n0, n1);
+                        }
+
+                        template<typename Writer>
+                        static void write(const g2_precomp &prec_Q, Writer &out) {
+                            out(prec_Q.QX);
+                            out(prec_Q.QY);
+                            out(prec_Q.QY2);
+                            out(prec_Q.QX_over_twist);
+                            out(prec_Q.QY_over_twist);
+                            for (const auto &c : prec_Q.dbl_coeffs) {
+                                out(c.c_H);
+                                out(c.c_4C);
+                                out(c.c_J);
+                                out(c.c_L);
+                            }
+                            for (const auto &c : prec_Q.add_coeffs) {
+                                out(c.c_L1);
+                                out(c.c_RZ);
+                            }
+                        }
+
+                        template<typename Writer>
+                        static void write(const affine_ate_g2_precomp &prec_Q, Writer &out) {
+                            out(prec_Q.QX);
+                            out(prec_Q.QY);
+                            for (const auto &c : prec_Q.coeffs) {
+                                out(c.old_RX);
+                                out(c.old_RY);
+                                out(c.gamma);
+                                out(c.gamma_twist);
+                                out(c.gamma_X);
+                            }
+                        }
+
+                        template<typename Reader>
+                        static bool read(Reader &in, std::uint64_t n0, std::uint64_t n1, g2_precomp &prec_Q) {
+                            std::uint64_t dbl_num, add_num;
+                            expected_counts(&prec_Q, dbl_num, add_num);
+                            if (n0 != dbl_num || n1 != add_num) {
+                                return false;
+                            }
+                            prec_Q.QX = in();
+                            prec_Q.QY = in();
+                            prec_Q.QY2 = in();
+                            prec_Q.QX_over_twist = in();
+                            prec_Q.QY_over_twist = in();
+                            prec_Q.dbl_coeffs.resize(n0);
+                            for (auto &c : prec_Q.dbl_coeffs) {
+                                c.c_H = in();
+                                c.c_4C = in();
+                                c.c_J = in();
+                                c.c_L = in();
+                            }
+                            prec_Q.add_coeffs.resize(n1);
+                            for (auto &c : prec_Q.add_coeffs) {
+                                c.c_L1 = in();
+                                c.c_RZ = in();
+                            }
+                            return true;
+                        }
+
+                        template<typename Reader>
+                        static bool read(Reader &in, std::uint64_t n0, std::uint64_t n1,
+                                         affine_ate_g2_precomp &prec_Q) {
+                            std::uint64_t coeffs_num, unused;
+                            expected_counts(&prec_Q, coeffs_num, unused);
+                            if (n0 != coeffs_num || n1 != 0) {
+                                return false;
+                            }
+                            prec_Q.QX = in();
+                            prec_Q.QY = in();
+                            prec_Q.coeffs.resize(n0);
+                            for (auto &c : prec_Q.coeffs) {
+                                c.old_RX = in();
+                                c.old_RY = in();
+                                c.gamma = in();
+                                c.gamma_twist = in();
+                                c.gamma_X = in();
+                            }
+                            return true;
+                        }
+                    };
+
+                    template<typename CurveType>
+                    struct g2_precomp_layout;
+
+                    template<std::size_t Version>
+                    struct g2_precomp_layout<curves::bls12<Version>>
+                        : ell_coeffs_precomp_layout<typename curves::bls12<Version>::pairing> { };
+
+                    template<std::size_t Version>
+                    struct g2_precomp_layout<curves::alt_bn128<Version>>
+                        : ell_coeffs_precomp_layout<typename curves::alt_bn128<Version>::pairing> { };
+
+                    template<std::size_t Version>
+                    struct g2_precomp_layout<curves::mnt4<Version>>
+                        : mnt_precomp_layout<typename curves::mnt4<Version>::pairing> { };
+
+                    template<std::size_t Version>
+                    struct g2_precomp_layout<curves::mnt6<Version>>
+                        : mnt_precomp_layout<typename curves::mnt6<Version>::pairing> { };
+                }    // namespace detail
+
+                /**
+                 * Stable binary format for the G2 precomputations of a curve (g2_precomp and
+                 * affine_ate_g2_precomp), so that the precomputations of fixed verifying key points can be
+                 * written once and restored on start-up instead of replaying the doubling and addition
+                 * schedule.
+                 *
+                 * The header consists of the magic "C3G2", the format version, a fingerprint of the base field
+                 * modulus, the precomputation kind, two coefficient counts and an FNV-1a checksum of the payload,
+                 * little-endian. The payload is a sequence of fixed-size field_bincode records of twist field
+                 * elements, so a file can be decoded directly from a read-only memory mapping.
+                 */
+                template<typename CurveType>
+                struct g2_precomp_codec {
+                    typedef typename CurveType::pairing pairing_policy;
+                    typedef typename pairing_policy::g2_precomp g2_precomp;
+                    typedef typename pairing_policy::affine_ate_g2_precomp affine_ate_g2_precomp;
+                    typedef typename pairing_policy::fq_type fq_type;
+                    typedef typename pairing_policy::fqe_type twist_field_type;
+
+                    typedef detail::g2_precomp_layout<CurveType> layout_type;
+                    typedef nil::marshalling::field_bincode<twist_field_type> element_bincode;
+
+                    typedef std::uint8_t chunk_type;
+
+                    constexpr static const std::uint32_t format_version = 2;
+                    constexpr static const std::size_t header_octets_num = 4 + 4 + 5 * 8;
+                    constexpr static const std::size_t element_octets_num = element_bincode::field_octets_num;
+
+                    /**
+                     * Identifies the curve a file was produced for: the checksum of the little-endian base field
+                     * modulus.
+                     */
+                    static std::uint64_t curve_fingerprint() {
+                        std::vector<chunk_type> modulus;
+                        ::nil::crypto3::multiprecision::export_bits(fq_type::modulus, std::back_inserter(modulus), 8,
+                                                                    false);
+                        return detail::precomp_checksum(modulus.data(), modulus.data() + modulus.size());
+                    }
+
+                    template<typename Precomp>
+                    static std::size_t serialized_size(const Precomp &prec_Q) {
+                        std::uint64_t n0, n1;
+                        layout_type::counts(prec_Q, n0, n1);
+                        return header_octets_num + layout_type::elements_num(n0, n1, &prec_Q) * element_octets_num;
+                    }
+
+                    /**
+                     * @param prec_Q either a g2_precomp or an affine_ate_g2_precomp of this curve
+                     */
+                    template<typename Precomp, typename OutputIterator>
+                    static OutputIterator to_bytes(const Precomp &prec_Q, OutputIterator out) {
+                        std::uint64_t n0, n1;
+                        layout_type::counts(prec_Q, n0, n1);
+
+                        std::vector<chunk_type> buffer(serialized_size(prec_Q));
+                        detail::precomp_element_writer<twist_field_type> writer {buffer.data() + header_octets_num};
+                        layout_type::write(prec_Q, writer);
+
+                        chunk_type *p = buffer.data();
+                        p[0] = 'C';
+                        p[1] = '3';
+                        p[2] = 'G';
+                        p[3] = '2';
+                        p = write_integral(p + 4, format_version, 4);
+                        p = write_integral(p, curve_fingerprint(), 8);
+                        p = write_integral(p, layout_type::kind(&prec_Q), 8);
+                        p = write_integral(p, n0, 8);
+                        p = write_integral(p, n1, 8);
+                        write_integral(p, detail::precomp_checksum(buffer.data() + header_octets_num,
+                                                                   buffer.data() + buffer.size()),
+                                       8);
+
+                        return std::copy(buffer.begin(), buffer.end(), out);
+                    }
+
+                    template<typename Precomp>
+                    static std::vector<chunk_type> to_bytes(const Precomp &prec_Q) {
+                        std::vector<chunk_type> result;
+                        result.reserve(serialized_size(prec_Q));
+                        to_bytes(prec_Q, std::back_inserter(result));
+                        return result;
+                    }
+
+                    /**
+                     * Restores a precomputation from its byte representation, e.g. from a read-only memory mapping
+                     * of a file produced by to_bytes(). The first element of the result is false if the header
+                     * does not match this curve and precomputation kind, if the checksum does not match or if any
+                     * coordinate is out of range.
+                     */
+                    template<typename Precomp>
+                    static std::pair<bool, Precomp> from_bytes(const chunk_type *first, const chunk_type *last) {
+                        Precomp result;
+                        const std::size_t length = std::distance(first, last);
+
+                        if (length < header_octets_num || first[0] != 'C' || first[1] != '3' || first[2] != 'G' ||
+                            first[3] != '2' || read_integral(first + 4, 4) != format_version ||
+                            read_integral(first + 8, 8) != curve_fingerprint() ||
+                            read_integral(first + 16, 8) != layout_type::kind(&result)) {
+                            return std::make_pair(false, result);
+                        }
+
+                        const std::uint64_t n0 = read_integral(first + 24, 8);
+                        const std::uint64_t n1 = read_integral(first + 32, 8);
+                        const std::uint64_t max_elements = (length - header_octets_num) / element_octets_num;
+
+                        // bound the counts first so that elements_num cannot overflow
+                        if (n0 > max_elements || n1 > max_elements ||
+                            layout_type::elements_num(n0, n1, &result) * element_octets_num !=
+                                length - header_octets_num ||
+                            read_integral(first + 40, 8) != detail::precomp_checksum(first + header_octets_num, last)) {
+                            return std::make_pair(false, result);
+                        }
+
+                        detail::precomp_element_reader<twist_field_type> reader {first + header_octets_num, true};
+                        const bool valid = layout_type::read(reader, n0, n1, result) && reader.valid;
+
+                        return std::make_pair(valid, result);
+                    }
+
+                private:
+                    static chunk_type *write_integral(chunk_type *out, std::uint64_t value, std::size_t octets) {
+                        for (std::size_t i = 0; i < octets; ++i) {
+                            out[i] = static_cast<chunk_type>(value >> (8 * i));
+                        }
+                        return out + octets;
+                    }
+
+                    static std::uint64_t read_integral(const chunk_type *in, std::size_t octets) {
+                        std::uint64_t value = 0;
+                        for (std::size_t i = 0; i < octets; ++i) {
+                            value |= static_cast<std::uint64_t>(in[i]) << (8 * i);
+                        }
+                        return value;
+                    }
+                };
+
+                template<typename CurveType>
+                constexpr std::uint32_t const g2_precomp_codec<CurveType>::format_version;
+
+                template<typename CurveType>
+                constexpr std::size_t const g2_precomp_codec<CurveType>::header_octets_num;
+
+                template<typename CurveType>
+                constexpr std::size_t const g2_precomp_codec<CurveType>::element_octets_num;
+            }    // namespace pairing
+        }        // namespace algebra
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_PAIRING_G2_PRECOMP_CODEC_HPP
@@ -0,0 +1,105 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_PAIRING_GT_SUBGROUP_CHECK_HPP
+#define CRYPTO3_ALGEBRA_PAIRING_GT_SUBGROUP_CHECK_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include <boost/random/random_device.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+
+#include <nil/crypto3/algebra/multiexp/gt_multiexp.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace pairing {
+
+                /**
+                 * Checks that elt lies in the order-r target group GT of CurveType (BLS12 and BN curves), see
+                 * the gt_subgroup_check of the curve's pairing policy.
+                 */
+                template<typename CurveType>
+                bool gt_subgroup_check(const typename CurveType::pairing::gt_type::value_type &elt) {
+                    return CurveType::pairing::gt_subgroup_check(elt);
+                }
+
+                /**
+                 * Checks that all elements of [first, last) lie in GT with a random linear combination: every
+                 * element is checked to be cyclotomic, which is cheap, and then a single membership test is
+                 * run on prod_i g_i^{c_i} for random 64-bit c_i, computed as one multi-exponentiation.
+                 *
+                 * If some element is outside GT, one round accepts with probability at most 1/min(2^64, l),
+                 * where l is the smallest prime factor of (q^4 - q^2 + 1)/r. For BLS12-381 l = 4513, so
+                 * callers needing a small error there have to ask for several independent rounds.
+                 */
+                template<typename CurveType, typename InputGTIterator>
+                bool gt_batch_subgroup_check(InputGTIterator first, InputGTIterator last, std::size_t rounds = 1) {
+                    typedef typename CurveType::pairing pairing_policy;
+                    typedef typename pairing_policy::gt_type::value_type gt_value_type;
+                    typedef typename CurveType::scalar_field_type::modulus_type modulus_type;
+
+                    constexpr std::size_t coefficient_bits = 64;
+
+                    const std::vector<gt_value_type> bases(first, last);
+                    if (bases.empty()) {
+                        return true;
+                    }
+                    for (const gt_value_type &g : bases) {
+                        if (!pairing_policy::cyclotomic_subgroup_check(g)) {
+                            return false;
+                        }
+                    }
+
+                    const std::size_t n = bases.size();
+                    const std::size_t c = algebra::detail::gt_multiexp_window(n, coefficient_bits);
+                    const std::size_t windows = algebra::detail::signed_windows_count(coefficient_bits, c);
+                    std::vector<std::int64_t> digits(n * windows);
+
+                    boost::random_device rd;
+                    boost::random::uniform_int_distribution<std::uint64_t> distribution;
+
+                    for (std::size_t round = 0; round < rounds; ++round) {
+                        for (std::size_t j = 0; j < n; ++j) {
+                            algebra::detail::signed_window_digits(modulus_type(distribution(rd)), c, windows,
+                                                                  &digits[j * windows]);
+                        }
+
+                        if (!pairing_policy::gt_subgroup_check(
+                                algebra::detail::cyclotomic_bucket_product(bases, digits, windows, c))) {
+                            return false;
+                        }
+                    }
+
+                    return true;
+                }
+            }    // namespace pairing
+        }        // namespace algebra
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_PAIRING_GT_SUBGROUP_CHECK_HPP
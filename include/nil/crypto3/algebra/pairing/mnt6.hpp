@@ -27,6 +27,7 @@
 #define CRYPTO3_ALGEBRA_PAIRING_MNT6_POLICY_HPP
 
 #include <numeric>
+#include <vector>
 
 namespace nil {
     namespace crypto3 {
@@ -127,11 +128,39 @@ namespace nil {
                         return policy_type::double_miller_loop(prec_P1, prec_Q1, prec_P2, prec_Q2);
                     }
 
+                    static inline typename gt_type::value_type
+                        multi_miller_loop(const std::vector<g1_precomp> &prec_P,
+                                          const std::vector<g2_precomp> &prec_Q) {
+                        return policy_type::multi_miller_loop(prec_P, prec_Q);
+                    }
+
+                    static inline typename gt_type::value_type
+                        multi_miller_loop(const std::vector<g1_precomp> &prec_P,
+                                          const std::vector<const g2_precomp *> &prec_Q) {
+                        return policy_type::multi_miller_loop(prec_P, prec_Q);
+                    }
+
+                    /**
+                     * Checks prod_i e(P_i, Q_i) == 1 with one shared Miller loop and a single final
+                     * exponentiation, e.g. for Groth16 or aggregate signature verification.
+                     */
+                    static inline bool pairing_product_is_one(const std::vector<g1_precomp> &prec_P,
+                                                              const std::vector<g2_precomp> &prec_Q) {
+                        return policy_type::final_exponentiation(policy_type::multi_miller_loop(prec_P, prec_Q)) ==
+                               gt_type::value_type::one();
+                    }
+
                     static inline typename gt_type::value_type
                         final_exponentiation(const typename gt_type::value_type &elt) {
                         return policy_type::final_exponentiation(elt);
                     }
 
+                    static inline typename gt_type::value_type
+                        final_exponentiation(const typename gt_type::value_type &elt,
+                                             const typename gt_type::value_type &elt_inv) {
+                        return policy_type::final_exponentiation(elt, elt_inv);
+                    }
+
                     static inline typename gt_type::value_type miller_loop(const g1_precomp &prec_P,
                                                                            const g2_precomp &prec_Q) {
                         return policy_type::miller_loop(prec_P, prec_Q);
@@ -25,6 +25,8 @@
 #ifndef CRYPTO3_ALGEBRA_WNAF_HPP
 #define CRYPTO3_ALGEBRA_WNAF_HPP
 
+#include <vector>
+
 #include <nil/crypto3/multiprecision/wnaf.hpp>
 
 #include <nil/crypto3/algebra/curves/params.hpp>
@@ -32,11 +34,14 @@
 namespace nil {
     namespace crypto3 {
         namespace algebra {
-            template<typename BaseValueType, typename Backend,
-                     multiprecision::expression_template_option ExpressionTemplates>
-            BaseValueType fixed_window_wnaf_exp(const std::size_t window_size, const BaseValueType &base,
-                                                const multiprecision::number<Backend, ExpressionTemplates> &scalar) {
-                std::vector<long> naf = multiprecision::find_wnaf(window_size, scalar);
+            /**
+             * Odd multiples base, 3 * base, ..., (2^{window_size} - 1) * base used by the wNAF evaluation.
+             * Bases exponentiated repeatedly can keep their table and use the overload of
+             * fixed_window_wnaf_exp taking it.
+             */
+            template<typename BaseValueType>
+            std::vector<BaseValueType> fixed_window_wnaf_table(const std::size_t window_size,
+                                                               const BaseValueType &base) {
                 std::vector<BaseValueType> table(1ul << (window_size - 1));
                 BaseValueType tmp = base;
                 BaseValueType dbl = base.doubled();
@@ -45,6 +50,16 @@ namespace nil {
                     tmp = tmp + dbl;
                 }
 
+                return table;
+            }
+
+            template<typename BaseValueType, typename Backend,
+                     multiprecision::expression_template_option ExpressionTemplates>
+            BaseValueType fixed_window_wnaf_exp(const std::size_t window_size,
+                                                const std::vector<BaseValueType> &table,
+                                                const multiprecision::number<Backend, ExpressionTemplates> &scalar) {
+                std::vector<long> naf = multiprecision::find_wnaf(window_size, scalar);
+
                 BaseValueType res = BaseValueType::zero();
                 bool found_nonzero = false;
                 for (long i = naf.size() - 1; i >= 0; --i) {
@@ -65,6 +80,13 @@ namespace nil {
                 return res;
             }
 
+            template<typename BaseValueType, typename Backend,
+                     multiprecision::expression_template_option ExpressionTemplates>
+            BaseValueType fixed_window_wnaf_exp(const std::size_t window_size, const BaseValueType &base,
+                                                const multiprecision::number<Backend, ExpressionTemplates> &scalar) {
+                return fixed_window_wnaf_exp(window_size, fixed_window_wnaf_table(window_size, base), scalar);
+            }
+
             // TODO: check, that CurveGroupValueType is a curve group element. Otherwise it has no wnaf_window_table
             template<typename CurveGroupValueType, typename Backend,
                      multiprecision::expression_template_option ExpressionTemplates>
@@ -0,0 +1,70 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_DETAIL_PARALLEL_HPP
+#define CRYPTO3_DETAIL_PARALLEL_HPP
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+namespace nil {
+    namespace crypto3 {
+        namespace detail {
+            /**
+             * Splits [0, size) into at most thread_count contiguous blocks and calls f(begin, end) for each
+             * of them on its own thread, the calling thread taking the first block. thread_count = 0 means
+             * one thread per hardware thread.
+             */
+            template<typename Function>
+            void parallel_for(std::size_t size, std::size_t thread_count, Function f) {
+                if (thread_count == 0) {
+                    thread_count = std::max(1u, std::thread::hardware_concurrency());
+                }
+                thread_count = std::max<std::size_t>(1, std::min(thread_count, size));
+
+                if (thread_count == 1) {
+                    f(std::size_t(0), size);
+                    return;
+                }
+
+                const std::size_t block_size = (size + thread_count - 1) / thread_count;
+
+                std::vector<std::thread> workers;
+                workers.reserve(thread_count - 1);
+                for (std::size_t begin = block_size; begin < size; begin += block_size) {
+                    workers.emplace_back(f, begin, std::min(size, begin + block_size));
+                }
+
+                f(std::size_t(0), std::min(size, block_size));
+
+                for (std::thread &worker : workers) {
+                    worker.join();
+                }
+            }
+        }    // namespace detail
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_DETAIL_PARALLEL_HPP
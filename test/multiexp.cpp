@@ -29,15 +29,24 @@
 #include <boost/test/data/test_case.hpp>
 #include <boost/test/data/monomorphic.hpp>
 
+#include <algorithm>
 #include <cstdio>
+#include <sstream>
 #include <vector>
 #include <chrono>
 #include <ctime>
 
+#include <nil/crypto3/algebra/multiexp/batch.hpp>
 #include <nil/crypto3/algebra/multiexp/multiexp.hpp>
 #include <nil/crypto3/algebra/multiexp/policies.hpp>
+#include <nil/crypto3/algebra/multiexp/digit_plan.hpp>
+#include <nil/crypto3/algebra/multiexp/incremental.hpp>
+#include <nil/crypto3/algebra/multiexp/precomputed.hpp>
+#include <nil/crypto3/algebra/multiexp/streaming.hpp>
+#include <nil/crypto3/algebra/multiexp/tuning.hpp>
 
 #include <nil/crypto3/algebra/curves/alt_bn128.hpp>
+#include <nil/crypto3/algebra/curves/babyjubjub.hpp>
 #include <nil/crypto3/algebra/curves/bls12.hpp>
 //#include <nil/crypto3/algebra/curves/bn128.hpp>
 // #include <nil/crypto3/algebra/curves/brainpool_r1.hpp>
@@ -55,6 +64,9 @@
 // #include <nil/crypto3/algebra/curves/sm2p_v1.hpp>
 // #include <nil/crypto3/algebra/curves/x962_p.hpp>
 
+#include <nil/crypto3/algebra/curves/params/glv/alt_bn128.hpp>
+#include <nil/crypto3/algebra/curves/params/glv/bls12.hpp>
+
 #include <nil/crypto3/algebra/curves/params/multiexp/alt_bn128.hpp>
 #include <nil/crypto3/algebra/curves/params/multiexp/bls12.hpp>
 //#include <nil/crypto3/algebra/curves/params/multiexp/bn128.hpp>
@@ -73,10 +85,25 @@
 // #include <nil/crypto3/algebra/curves/params/multiexp/sm2p_v1.hpp>
 // #include <nil/crypto3/algebra/curves/params/multiexp/x962_p.hpp>
 
+#include <nil/crypto3/algebra/fields/detail/batch_inversion.hpp>
+
 #include <nil/crypto3/algebra/random_element.hpp>
 
 using namespace nil::crypto3::algebra;
 
+namespace boost {
+    namespace test_tools {
+        namespace tt_detail {
+            template<>
+            struct print_log_value<curves::bls12<381>::g1_type::value_type> {
+                void operator()(std::ostream &os, const curves::bls12<381>::g1_type::value_type &e) {
+                    os << "(" << e.X.data << "," << e.Y.data << "," << e.Z.data << ")";
+                }
+            };
+        }    // namespace tt_detail
+    }        // namespace test_tools
+}    // namespace boost
+
 template<typename GroupType>
 using run_result_t = std::pair<long long, std::vector<typename GroupType::value_type>>;
 
@@ -159,8 +186,8 @@ void print_performance_csv(size_t expn_start, std::size_t expn_end_fast, std::si
         printf("\t%lld", result_djb.first);
         fflush(stdout);
 
-        if (compare_answers && (result_bos_coster.second != result_djb.second)) {
-            fprintf(stderr, "Answers NOT MATCHING (bos coster != djb)\n");
+        if (compare_answers) {
+            BOOST_CHECK(result_bos_coster.second == result_djb.second);
         }
 
         if (expn <= expn_end_naive) {
@@ -169,8 +196,8 @@ void print_performance_csv(size_t expn_start, std::size_t expn_end_fast, std::si
             printf("\t%lld", result_naive.first);
             fflush(stdout);
 
-            if (compare_answers && (result_bos_coster.second != result_naive.second)) {
-                fprintf(stderr, "Answers NOT MATCHING (bos coster != naive)\n");
+            if (compare_answers) {
+                BOOST_CHECK(result_bos_coster.second == result_naive.second);
             }
         }
 
@@ -189,4 +216,511 @@ BOOST_AUTO_TEST_CASE(multiexp_test_case) {
     print_performance_csv<curves::bls12<381>::g2_type, curves::bls12<381>::scalar_field_type>(2, 20, 14, true);
 }
 
+
+BOOST_AUTO_TEST_CASE(multiexp_precomputed_test_case) {
+    typedef curves::bls12<381>::g1_type group_type;
+    typedef curves::bls12<381>::scalar_field_type field_type;
+
+    const std::size_t size = 64;
+
+    std::vector<typename group_type::value_type> bases;
+    std::vector<typename field_type::value_type> scalars;
+    for (std::size_t i = 0; i < size; i++) {
+        bases.push_back(random_element<group_type>());
+        scalars.push_back(random_element<field_type>());
+    }
+
+    typename group_type::value_type expected = multiexp<policies::multiexp_method_BDLO12>(
+        bases.cbegin(), bases.cend(), scalars.cbegin(), scalars.cend(), 1);
+
+    multiexp_precomputed<group_type> full(bases.cbegin(), bases.cend(), 4);
+    BOOST_CHECK_EQUAL(full.window_stride(), 1);
+    BOOST_CHECK(multiexp(full, scalars.cbegin(), scalars.cend()) == expected);
+
+    // a budget of a few copies per base forces several windows to share one copy
+    multiexp_precomputed<group_type> strided(bases.cbegin(), bases.cend(), 4,
+                                             size * 8 * sizeof(typename group_type::value_type));
+    BOOST_CHECK(strided.window_stride() > 1);
+    BOOST_CHECK(multiexp(strided, scalars.cbegin(), scalars.cend()) == expected);
+
+    std::vector<std::uint8_t> bytes = strided.to_bytes();
+    BOOST_CHECK_EQUAL(bytes.size(), strided.serialized_size());
+
+    std::pair<bool, multiexp_precomputed<group_type>> restored =
+        multiexp_precomputed<group_type>::from_bytes(bytes.data(), bytes.data() + bytes.size());
+    BOOST_CHECK(restored.first);
+    BOOST_CHECK(multiexp(restored.second, scalars.cbegin(), scalars.cend()) == expected);
+
+    bytes[4] ^= 0xff;
+    BOOST_CHECK(!multiexp_precomputed<group_type>::from_bytes(bytes.data(), bytes.data() + bytes.size()).first);
+    bytes[4] ^= 0xff;
+
+    // a bases count whose product with the row count wraps around
+    std::vector<std::uint8_t> wrapped = bytes;
+    std::fill(wrapped.begin() + 8, wrapped.begin() + 16, 0xff);
+    BOOST_CHECK(!multiexp_precomputed<group_type>::from_bytes(wrapped.data(), wrapped.data() + wrapped.size()).first);
+
+    // a point off the curve
+    const std::size_t header_octets_num = multiexp_precomputed<group_type>::header_octets_num;
+    const std::size_t point_octets_num = multiexp_precomputed<group_type>::point_octets_num;
+    bytes[header_octets_num + point_octets_num - 1] ^= 0x01;
+    BOOST_CHECK(!multiexp_precomputed<group_type>::from_bytes(bytes.data(), bytes.data() + bytes.size()).first);
+}
+
+BOOST_AUTO_TEST_CASE(signed_window_digits_test_case) {
+    typedef curves::bls12<381>::scalar_field_type field_type;
+    typedef typename field_type::value_type field_value_type;
+    typedef typename field_type::modulus_type modulus_type;
+
+    // r - 1 sets the top bits, so the top window carries whenever modulus_bits % c == c - 1
+    const std::vector<field_value_type> scalars = {-field_value_type::one(), random_element<field_type>()};
+
+    for (std::size_t c = 2; c < 10; ++c) {
+        const std::size_t windows = detail::signed_windows_count(field_type::modulus_bits, c);
+
+        for (const field_value_type &scalar : scalars) {
+            const std::vector<std::int64_t> digits =
+                detail::signed_window_digits(scalar.data.template convert_to<modulus_type>(), c, windows);
+
+            field_value_type recoded = field_value_type::zero();
+            for (std::size_t k = windows; k-- > 0;) {
+                recoded = recoded * field_value_type(std::size_t(1) << c);
+                recoded = digits[k] < 0 ? recoded - field_value_type(std::size_t(-digits[k])) :
+                                          recoded + field_value_type(std::size_t(digits[k]));
+            }
+
+            BOOST_CHECK(recoded == scalar);
+        }
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE(multiexp_tuning_profile_test_case) {
+    typedef curves::bls12<381>::g1_type group_type;
+    typedef curves::bls12<381>::scalar_field_type field_type;
+
+    multiexp_tuning_profile profile;
+    profile.ranges.push_back({1, multiexp_method_type::naive_plain, 0});
+    profile.ranges.push_back({8, multiexp_method_type::bos_coster, 0});
+    profile.ranges.push_back({32, multiexp_method_type::BDLO12, 5});
+    profile.fixed_base_exp_window_table = {1, 4, 0, 30};
+
+    std::stringstream stream;
+    write_multiexp_tuning_profiles(stream, {{multiexp_tuning<group_type>::key(), profile}});
+
+    BOOST_CHECK(multiexp_tuning<group_type>::load(stream));
+    BOOST_CHECK_EQUAL(multiexp_tuning<group_type>::profile().ranges.size(), 3);
+    BOOST_CHECK(multiexp_tuning<group_type>::profile().find(16)->method == multiexp_method_type::bos_coster);
+    BOOST_CHECK_EQUAL(multiexp_tuning<group_type>::profile().find(100)->window, 5);
+    BOOST_CHECK_EQUAL(get_exp_window_size<group_type>(10), 2);
+    BOOST_CHECK_EQUAL(get_exp_window_size<group_type>(100), 4);
+
+    for (std::size_t size : {4, 16, 64}) {
+        std::vector<typename group_type::value_type> bases;
+        std::vector<typename field_type::value_type> scalars;
+        for (std::size_t i = 0; i < size; i++) {
+            bases.push_back(random_element<group_type>());
+            scalars.push_back(random_element<field_type>());
+        }
+
+        BOOST_CHECK(multiexp<policies::multiexp_method_tuned>(bases.cbegin(), bases.cend(), scalars.cbegin(),
+                                                              scalars.cend(), 1) ==
+                    multiexp<policies::multiexp_method_naive_plain>(bases.cbegin(), bases.cend(),
+                                                                    scalars.cbegin(), scalars.cend(), 1));
+    }
+
+    multiexp_tuning<group_type>::set(multiexp_tuning_profile());
+}
+
+BOOST_AUTO_TEST_CASE(multiexp_tuning_profile_window_test_case) {
+    typedef curves::bls12<381>::g1_type group_type;
+
+    multiexp_tuning_profile valid;
+    valid.ranges.push_back({1, multiexp_method_type::BDLO12, 4});
+    multiexp_tuning<group_type>::set(valid);
+
+    multiexp_tuning_profile zero_window;
+    zero_window.ranges.push_back({1, multiexp_method_type::BDLO12, 0});
+
+    multiexp_tuning_profile wide_window;
+    wide_window.ranges.push_back({1, multiexp_method_type::BDLO12, detail::multiexp_max_window + 1});
+
+    multiexp_tuning_profile long_table;
+    long_table.fixed_base_exp_window_table.assign(detail::multiexp_max_window + 1, 1);
+
+    for (const multiexp_tuning_profile &profile : {zero_window, wide_window, long_table}) {
+        std::stringstream stream;
+        write_multiexp_tuning_profiles(stream, {{multiexp_tuning<group_type>::key(), profile}});
+
+        BOOST_CHECK(!multiexp_tuning<group_type>::load(stream));
+        // a rejected profile leaves the installed one in place
+        BOOST_CHECK_EQUAL(multiexp_tuning<group_type>::profile().ranges.size(), 1);
+        BOOST_CHECK_EQUAL(multiexp_tuning<group_type>::profile().find(1)->window, 4);
+    }
+
+    multiexp_tuning_profile widest;
+    widest.ranges.push_back({1, multiexp_method_type::BDLO12, detail::multiexp_max_window});
+
+    std::stringstream stream;
+    write_multiexp_tuning_profiles(stream, {{multiexp_tuning<group_type>::key(), widest}});
+    BOOST_CHECK(multiexp_tuning<group_type>::load(stream));
+
+    multiexp_tuning<group_type>::set(multiexp_tuning_profile());
+}
+
+
+BOOST_AUTO_TEST_CASE(multiexp_streaming_test_case) {
+    typedef curves::bls12<381>::g1_type group_type;
+    typedef curves::bls12<381>::scalar_field_type field_type;
+
+    const std::size_t size = 100;
+
+    std::vector<typename group_type::value_type> bases;
+    std::vector<typename field_type::value_type> scalars;
+    for (std::size_t i = 0; i < size; i++) {
+        bases.push_back(random_element<group_type>());
+        scalars.push_back(random_element<field_type>());
+    }
+
+    typename group_type::value_type expected = multiexp<policies::multiexp_method_BDLO12>(
+        bases.cbegin(), bases.cend(), scalars.cbegin(), scalars.cend(), 1);
+
+    BOOST_CHECK(multiexp_streaming<group_type>(bases.cbegin(), bases.cend(), scalars.cbegin(), 16) == expected);
+
+    std::vector<std::uint8_t> bytes;
+    write_streaming_bases<group_type>(bases.cbegin(), bases.cend(), std::back_inserter(bytes));
+
+    std::pair<bool, typename group_type::value_type> streamed =
+        multiexp_streaming<group_type>(bytes.data(), bytes.data() + bytes.size(), scalars.cbegin(), 32, 5);
+    BOOST_CHECK(streamed.first);
+    BOOST_CHECK(streamed.second == expected);
+}
+
+
+BOOST_AUTO_TEST_CASE(multiexp_batch_test_case) {
+    typedef curves::bls12<381>::g1_type group_type;
+    typedef curves::bls12<381>::scalar_field_type field_type;
+    typedef typename group_type::value_type group_value_type;
+    typedef typename field_type::value_type field_value_type;
+
+    const std::size_t size = 50;
+
+    std::vector<group_value_type> bases;
+    for (std::size_t i = 0; i < size; i++) {
+        bases.push_back(random_element<group_type>());
+    }
+    bases[7] = group_value_type::zero();
+
+    std::vector<std::vector<field_value_type>> scalar_vectors(4);
+    for (std::size_t i = 0; i < size; i++) {
+        scalar_vectors[0].push_back(random_element<field_type>());
+        scalar_vectors[1].push_back(i % 3 == 0 ? field_value_type::zero() : -field_value_type(i));
+    }
+    // a shorter vector, whose missing scalars count as zero, and an empty one
+    scalar_vectors[2].assign(scalar_vectors[0].begin(), scalar_vectors[0].begin() + size / 2);
+
+    for (std::size_t window : {0, 2, 3, 8}) {
+        const std::vector<group_value_type> result =
+            batch_multiexp(bases.cbegin(), bases.cend(), scalar_vectors, window);
+        BOOST_CHECK_EQUAL(result.size(), scalar_vectors.size());
+
+        for (std::size_t j = 0; j < scalar_vectors.size(); j++) {
+            BOOST_CHECK_EQUAL(result[j], multiexp<policies::multiexp_method_naive_plain>(
+                                             bases.cbegin(), bases.cbegin() + scalar_vectors[j].size(),
+                                             scalar_vectors[j].cbegin(), scalar_vectors[j].cend(), 1));
+        }
+    }
+
+    // more bases than one chunk of the smallest window
+    const std::size_t long_size = 1100;
+    std::vector<group_value_type> long_bases;
+    std::vector<std::vector<field_value_type>> long_scalars(1);
+    for (std::size_t i = 0; i < long_size; i++) {
+        long_bases.push_back(random_element<group_type>());
+        long_scalars[0].push_back(random_element<field_type>());
+    }
+
+    BOOST_CHECK_EQUAL(batch_multiexp(long_bases.cbegin(), long_bases.cend(), long_scalars, 2)[0],
+                      multiexp<policies::multiexp_method_BDLO12>(long_bases.cbegin(), long_bases.cend(),
+                                                                 long_scalars[0].cbegin(), long_scalars[0].cend(), 1));
+}
+
+
+BOOST_AUTO_TEST_CASE(multiexp_incremental_test_case) {
+    typedef curves::bls12<381>::g1_type group_type;
+    typedef curves::bls12<381>::scalar_field_type field_type;
+    typedef typename group_type::value_type group_value_type;
+    typedef typename field_type::value_type field_value_type;
+
+    const std::size_t size = 40;
+
+    std::vector<group_value_type> bases;
+    std::vector<field_value_type> scalars;
+    for (std::size_t i = 0; i < size; i++) {
+        bases.push_back(random_element<group_type>());
+        scalars.push_back(random_element<field_type>());
+    }
+
+    for (std::size_t wnaf_window : {0, 4}) {
+        std::vector<field_value_type> expected_scalars = scalars;
+        incremental_commitment<group_type> commitment(bases.cbegin(), bases.cend(), scalars.cbegin(),
+                                                      scalars.cend());
+        if (wnaf_window != 0) {
+            commitment.enable_wnaf_tables(wnaf_window);
+        }
+
+        for (std::size_t batch = 0; batch < 4; batch++) {
+            // a repeated index collapses into one delta
+            const field_value_type first = random_element<field_type>();
+            commitment.update(3, first);
+            commitment.update(3, first + field_value_type(batch + 1));
+            expected_scalars[3] = first + field_value_type(batch + 1);
+
+            // a zero delta leaves the commitment unchanged
+            commitment.update(10 + batch, expected_scalars[10 + batch]);
+
+            for (std::size_t i = 20 + batch; i < size; i += 5) {
+                expected_scalars[i] = batch == 2 ? field_value_type::zero() : random_element<field_type>();
+                commitment.update(i, expected_scalars[i]);
+            }
+
+            BOOST_CHECK(commitment.scalar(3) == expected_scalars[3]);
+            BOOST_CHECK(commitment.pending_updates() > 2);
+
+            BOOST_CHECK_EQUAL(commitment.commitment(),
+                              multiexp<policies::multiexp_method_naive_plain>(bases.cbegin(), bases.cend(),
+                                                                              expected_scalars.cbegin(),
+                                                                              expected_scalars.cend(), 1));
+            BOOST_CHECK_EQUAL(commitment.pending_updates(), 0);
+        }
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE(multiexp_digit_plan_test_case) {
+    typedef curves::bls12<381> curve_type;
+    typedef curve_type::scalar_field_type field_type;
+
+    const std::size_t size = 50;
+
+    std::vector<typename curve_type::g1_type::value_type> g1_bases;
+    std::vector<typename curve_type::g2_type::value_type> g2_bases;
+    std::vector<typename field_type::value_type> scalars;
+    for (std::size_t i = 0; i < size; i++) {
+        g1_bases.push_back(random_element<curve_type::g1_type>());
+        g2_bases.push_back(random_element<curve_type::g2_type>());
+        scalars.push_back(random_element<field_type>());
+    }
+    scalars[3] = field_type::value_type::zero();
+
+    multiexp_digit_plan<field_type> plan(scalars.cbegin(), scalars.cend());
+
+    auto result = multiexp(plan, g1_bases.cbegin(), g1_bases.cend(), g2_bases.cbegin(), g2_bases.cend());
+
+    BOOST_CHECK(result.first == multiexp<policies::multiexp_method_naive_plain>(
+                                    g1_bases.cbegin(), g1_bases.cend(), scalars.cbegin(), scalars.cend(), 1));
+    BOOST_CHECK(result.second == multiexp<policies::multiexp_method_naive_plain>(
+                                     g2_bases.cbegin(), g2_bases.cend(), scalars.cbegin(), scalars.cend(), 1));
+}
+
+
+BOOST_AUTO_TEST_CASE(multiexp_scalar_partitioning_test_case) {
+    typedef curves::bls12<381>::g1_type group_type;
+    typedef curves::bls12<381>::scalar_field_type field_type;
+    typedef typename field_type::value_type field_value_type;
+
+    std::vector<typename group_type::value_type> bases;
+    std::vector<field_value_type> scalars;
+    for (std::size_t i = 0; i < 120; i++) {
+        bases.push_back(random_element<group_type>());
+    }
+    for (std::size_t i = 0; i < 20; i++) {
+        scalars.push_back(field_value_type(i % 2));
+        scalars.push_back(field_value_type(200 + i));
+        scalars.push_back(field_value_type(60000 + i));
+        scalars.push_back(field_value_type(4000000000ul + i));
+        scalars.push_back(field_value_type(0xffffffffffffff00ul + i));
+        scalars.push_back(random_element<field_type>());
+    }
+
+    BOOST_CHECK(multiexp_with_scalar_partitioning<policies::multiexp_method_BDLO12>(
+                    bases.cbegin(), bases.cend(), scalars.cbegin(), scalars.cend(), 1) ==
+                multiexp<policies::multiexp_method_naive_plain>(bases.cbegin(), bases.cend(), scalars.cbegin(),
+                                                                scalars.cend(), 1));
+}
+
+template<typename CurveType>
+void check_glv_multiexp() {
+    typedef typename CurveType::g1_type group_type;
+    typedef typename CurveType::scalar_field_type field_type;
+    typedef typename field_type::value_type field_value_type;
+
+    std::vector<typename group_type::value_type> bases;
+    std::vector<field_value_type> scalars;
+    for (std::size_t i = 0; i < 64; i++) {
+        bases.push_back(random_element<group_type>());
+        scalars.push_back(random_element<field_type>());
+    }
+    scalars[0] = field_value_type::zero();
+    scalars[1] = field_value_type::one();
+    scalars[2] = -field_value_type::one();
+    bases[3] = group_type::value_type::zero();
+
+    BOOST_CHECK(multiexp<policies::multiexp_method_glv>(bases.cbegin(), bases.cend(), scalars.cbegin(),
+                                                        scalars.cend(), 1) ==
+                multiexp<policies::multiexp_method_naive_plain>(bases.cbegin(), bases.cend(), scalars.cbegin(),
+                                                                scalars.cend(), 1));
+}
+
+BOOST_AUTO_TEST_CASE(multiexp_glv_test_case) {
+    check_glv_multiexp<curves::bls12<381>>();
+    check_glv_multiexp<curves::bls12<377>>();
+    check_glv_multiexp<curves::alt_bn128<254>>();
+}
+
+BOOST_AUTO_TEST_CASE(multiexp_bos_coster_test_case) {
+    typedef curves::bls12<381>::g1_type group_type;
+    typedef curves::bls12<381>::scalar_field_type field_type;
+    typedef typename group_type::value_type group_value_type;
+    typedef typename field_type::value_type field_value_type;
+
+    auto bos_coster = [](const std::vector<group_value_type> &bases, const std::vector<field_value_type> &scalars) {
+        return multiexp<policies::multiexp_method_bos_coster>(bases.cbegin(), bases.cend(), scalars.cbegin(),
+                                                              scalars.cend(), 1);
+    };
+    auto naive = [](const std::vector<group_value_type> &bases, const std::vector<field_value_type> &scalars) {
+        return multiexp<policies::multiexp_method_naive_plain>(bases.cbegin(), bases.cend(), scalars.cbegin(),
+                                                               scalars.cend(), 1);
+    };
+
+    for (std::size_t size : {1, 2, 3, 17, 64}) {
+        std::vector<group_value_type> bases;
+        std::vector<field_value_type> scalars;
+        for (std::size_t i = 0; i < size; i++) {
+            bases.push_back(random_element<group_type>());
+            scalars.push_back(random_element<field_type>());
+        }
+        BOOST_CHECK_EQUAL(bos_coster(bases, scalars), naive(bases, scalars));
+
+        // zero scalars drop out of the heap
+        for (std::size_t i = 0; i < size; i += 2) {
+            scalars[i] = field_value_type::zero();
+        }
+        BOOST_CHECK_EQUAL(bos_coster(bases, scalars), naive(bases, scalars));
+
+        // equal scalars make the top two entries of the heap tie
+        std::fill(scalars.begin(), scalars.end(), scalars.back());
+        BOOST_CHECK_EQUAL(bos_coster(bases, scalars), naive(bases, scalars));
+
+        // small and close scalars take the subtraction path, a few wide ones the direct exponentiation
+        for (std::size_t i = 0; i < size; i++) {
+            scalars[i] = field_value_type(1000 + i % 3);
+        }
+        scalars[0] = random_element<field_type>();
+        BOOST_CHECK_EQUAL(bos_coster(bases, scalars), naive(bases, scalars));
+
+        std::fill(scalars.begin(), scalars.end(), field_value_type::zero());
+        BOOST_CHECK_EQUAL(bos_coster(bases, scalars), group_value_type::zero());
+    }
+}
+
+template<typename GroupType, typename FieldType>
+void check_fixed_base_exp(const typename GroupType::value_type &g) {
+    typedef typename GroupType::value_type group_value_type;
+    typedef typename FieldType::value_type field_value_type;
+
+    const std::size_t scalar_size = FieldType::modulus_bits;
+    const std::size_t window = 5;
+
+    std::vector<field_value_type> scalars = {field_value_type::zero(), field_value_type::one(),
+                                             -field_value_type::one(), field_value_type(31), field_value_type(32)};
+    for (std::size_t i = 0; i < 16; i++) {
+        scalars.push_back(random_element<FieldType>());
+    }
+    std::vector<group_value_type> expected;
+    for (const field_value_type &scalar : scalars) {
+        expected.push_back(scalar * g);
+    }
+
+    const flat_window_table<GroupType> flat = get_flat_window_table<GroupType>(scalar_size, window, g);
+    const window_table<GroupType> nested = get_window_table<GroupType>(scalar_size, window, g);
+    BOOST_CHECK_EQUAL(flat.size(), (scalar_size + window - 1) / window);
+    BOOST_CHECK_EQUAL(flat.row_size(), std::size_t(1) << window);
+    BOOST_CHECK_EQUAL(nested.size(), flat.size());
+
+    group_value_type shifted = g;
+    for (std::size_t i = 0; i < window; ++i) {
+        shifted = shifted.doubled();
+    }
+    BOOST_CHECK(flat[0][0].is_zero());
+    BOOST_CHECK(flat[0][3] == g.doubled() + g);
+    BOOST_CHECK(flat[1][1] == shifted);
+
+    bool rows_match = true;
+    for (std::size_t outer = 0; outer < flat.size(); ++outer) {
+        rows_match = rows_match && nested[outer].size() == flat.row_size() &&
+                     std::equal(nested[outer].begin(), nested[outer].end(), flat[outer]);
+    }
+    BOOST_CHECK(rows_match);
+
+    // flat tables are added with mixed_add, window_table rows with the full addition
+    BOOST_CHECK(batch_exp<GroupType, FieldType>(scalar_size, window, flat, scalars) == expected);
+    BOOST_CHECK(batch_exp<GroupType, FieldType>(scalar_size, window, flat, scalars, 3) == expected);
+    BOOST_CHECK(batch_exp<GroupType, FieldType>(scalar_size, window, nested, scalars, 0) == expected);
+
+    const field_value_type coeff = random_element<FieldType>();
+    std::vector<group_value_type> expected_with_coeff;
+    for (const field_value_type &scalar : scalars) {
+        expected_with_coeff.push_back((coeff * scalar) * g);
+    }
+    BOOST_CHECK(batch_exp_with_coeff<GroupType, FieldType>(scalar_size, window, flat, coeff, scalars, 2) ==
+                expected_with_coeff);
+    BOOST_CHECK(batch_exp_with_coeff<GroupType, FieldType>(scalar_size, window, nested, coeff, scalars) ==
+                expected_with_coeff);
+}
+
+BOOST_AUTO_TEST_CASE(multiexp_fixed_base_exp_test_case) {
+    check_fixed_base_exp<curves::bls12<381>::g1_type, curves::bls12<381>::scalar_field_type>(
+        random_element<curves::bls12<381>::g1_type>());
+    check_fixed_base_exp<curves::bls12<381>::g2_type, curves::bls12<381>::scalar_field_type>(
+        random_element<curves::bls12<381>::g2_type>());
+    check_fixed_base_exp<curves::mnt4<298>::g1_type, curves::mnt4<298>::scalar_field_type>(
+        random_element<curves::mnt4<298>::g1_type>());
+    check_fixed_base_exp<curves::edwards<183>::g1_type, curves::edwards<183>::scalar_field_type>(
+        random_element<curves::edwards<183>::g1_type>());
+
+    // BabyJubJub has no batch normalization: the table stays as computed and uses full additions
+    typedef curves::babyjubjub::g1_type babyjubjub_group_type;
+    const typename babyjubjub_group_type::value_type P(
+        typename babyjubjub_group_type::underlying_field_type::value_type(
+            0x274dbce8d15179969bc0d49fa725bddf9de555e0ba6a693c6adb52fc9ee7a82c_cppui252),
+        typename babyjubjub_group_type::underlying_field_type::value_type(
+            0x5ce98c61b05f47fe2eae9a542bd99f6b2e78246231640b54595febfd51eb853_cppui252));
+    check_fixed_base_exp<babyjubjub_group_type, curves::babyjubjub::scalar_field_type>(P);
+}
+
+BOOST_AUTO_TEST_CASE(batch_inversion_test_case) {
+    typedef curves::bls12<381>::base_field_type field_type;
+    typedef typename field_type::value_type field_value_type;
+
+    std::vector<field_value_type> elements = {field_value_type::one(), -field_value_type::one()};
+    for (std::size_t i = 0; i < 30; i++) {
+        elements.push_back(random_element<field_type>());
+    }
+    std::vector<field_value_type> inverses = elements;
+    fields::detail::batch_inversion(inverses.begin(), inverses.end());
+
+    for (std::size_t i = 0; i < elements.size(); i++) {
+        BOOST_CHECK(inverses[i] == elements[i].inversed());
+    }
+
+    std::vector<field_value_type> single = {elements[5]};
+    fields::detail::batch_inversion(single.begin(), single.end());
+    BOOST_CHECK(single.front() * elements[5] == field_value_type::one());
+
+    std::vector<field_value_type> empty;
+    fields::detail::batch_inversion(empty.begin(), empty.end());
+    BOOST_CHECK(empty.empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
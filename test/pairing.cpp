@@ -29,6 +29,7 @@
 #include <iostream>
 #include <vector>
 #include <array>
+#include <string>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
@@ -39,6 +40,7 @@
 
 #include <nil/crypto3/multiprecision/cpp_int.hpp>
 
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
 #include <nil/crypto3/algebra/curves/bls12.hpp>
 #include <nil/crypto3/algebra/curves/mnt4.hpp>
 #include <nil/crypto3/algebra/curves/mnt6.hpp>
@@ -47,6 +49,17 @@
 #include <nil/crypto3/algebra/fields/detail/element/fp4.hpp>
 #include <nil/crypto3/algebra/fields/detail/element/fp6_2over3.hpp>
 #include <nil/crypto3/algebra/fields/detail/element/fp12_2over3over2.hpp>
+#include <nil/crypto3/algebra/fields/detail/element/fp12_2over3over2_t2.hpp>
+
+#include <nil/crypto3/algebra/algorithms/pair.hpp>
+#include <nil/crypto3/algebra/marshalling.hpp>
+#include <nil/crypto3/algebra/pairing/bls_signature.hpp>
+#include <nil/crypto3/algebra/pairing/g2_precomp_cache.hpp>
+#include <nil/crypto3/algebra/pairing/g2_precomp_codec.hpp>
+#include <nil/crypto3/algebra/pairing/gt_subgroup_check.hpp>
+
+#include <nil/crypto3/algebra/multiexp/gt_multiexp.hpp>
+#include <nil/crypto3/algebra/multiexp/inner_product.hpp>
 
 using namespace nil::crypto3::algebra::pairing;
 using namespace nil::crypto3::algebra;
@@ -426,7 +439,16 @@ enum GT_enum : std::size_t {
 enum g1_precomp_enum : std::size_t { prec_A1, prec_A2 };
 enum g2_precomp_enum : std::size_t { prec_B1, prec_B2 };
 
-// TODO: add affine_pair_reduceding test
+template<typename G2Precomp>
+auto drop_last_line(G2Precomp &prec_Q) -> decltype(prec_Q.coeffs.pop_back()) {
+    prec_Q.coeffs.pop_back();
+}
+
+template<typename G2Precomp>
+auto drop_last_line(G2Precomp &prec_Q) -> decltype(prec_Q.dbl_coeffs.pop_back()) {
+    prec_Q.dbl_coeffs.pop_back();
+}
+
 template<typename PairingT, typename Fr_value_type, typename G1_value_type, typename G2_value_type,
          typename GT_value_type, typename g1_precomp_value_type, typename g2_precomp_value_type>
 void check_pairing_operations(std::vector<Fr_value_type> &Fr_elements,
@@ -497,6 +519,43 @@ void check_pairing_operations(std::vector<Fr_value_type> &Fr_elements,
         PairingT::pair_reduced(G1_elements[A1], G2_elements[B1]).pow(cpp_int(Fr_elements[VKx_poly].data)));
     std::cout << " * Reduced pairing tests with pow finished." << std::endl << std::endl;
 
+    std::cout << " * GT multi-exponentiation tests started..." << std::endl;
+    std::vector<GT_value_type> gt_bases = {PairingT::pair_reduced(G1_elements[A1], G2_elements[B1]),
+                                           PairingT::pair_reduced(G1_elements[A2], G2_elements[B2]),
+                                           PairingT::pair_reduced(G1_elements[C1], G2_elements[VKz])};
+    std::vector<Fr_value_type> gt_exponents = {Fr_elements[VKx_poly], -Fr_elements[VKy_poly], Fr_value_type::one()};
+    BOOST_CHECK_EQUAL(gt_multiexp<typename PairingT::g1_type::curve_type>(gt_bases.begin(), gt_bases.end(),
+                                                                          gt_exponents.begin(), gt_exponents.end()),
+                      PairingT::pair_reduced(Fr_elements[VKx_poly] * G1_elements[A1], G2_elements[B1]) *
+                          PairingT::pair_reduced(-Fr_elements[VKy_poly] * G1_elements[A2], G2_elements[B2]) *
+                          gt_bases[2]);
+    BOOST_CHECK_EQUAL(gt_exp<typename PairingT::g1_type::curve_type>(gt_bases[0], Fr_elements[VKx_poly]),
+                      PairingT::pair_reduced(Fr_elements[VKx_poly] * G1_elements[A1], G2_elements[B1]));
+    BOOST_CHECK_EQUAL(gt_exp<typename PairingT::g1_type::curve_type>(gt_bases[1], -Fr_elements[VKy_poly]),
+                      PairingT::pair_reduced(-Fr_elements[VKy_poly] * G1_elements[A2], G2_elements[B2]));
+    BOOST_CHECK_EQUAL(gt_bases[2].cyclotomic_exp(cpp_int(Fr_elements[VKx_poly].data)),
+                      gt_bases[2].pow(cpp_int(Fr_elements[VKx_poly].data)));
+    std::cout << " * GT multi-exponentiation tests finished." << std::endl << std::endl;
+
+    std::cout << " * Pairing inner product tests started..." << std::endl;
+    typedef typename PairingT::g1_type::curve_type curve_type;
+    std::vector<G1_value_type> ip_a = {G1_elements[A1], G1_elements[A2], G1_elements[C1]};
+    std::vector<G2_value_type> ip_b = {G2_elements[B1], G2_elements[B2], G2_elements[VKz]};
+    std::vector<g2_precomp_value_type> ip_b_prec = {PairingT::precompute_g2(G2_elements[B1]),
+                                                    PairingT::precompute_g2(G2_elements[B2]),
+                                                    PairingT::precompute_g2(G2_elements[VKz])};
+    const GT_value_type ip_expected = PairingT::pair_reduced(G1_elements[A1], G2_elements[B1]) *
+                                      PairingT::pair_reduced(G1_elements[A2], G2_elements[B2]) *
+                                      PairingT::pair_reduced(G1_elements[C1], G2_elements[VKz]);
+    BOOST_CHECK_EQUAL(pairing_inner_product<curve_type>(ip_a.begin(), ip_a.end(), ip_b.begin(), ip_b.end()),
+                      ip_expected);
+    BOOST_CHECK_EQUAL(pairing_inner_product<curve_type>(ip_a.begin(), ip_a.end(), ip_b.begin(), ip_b.end(), 2),
+                      ip_expected);
+    BOOST_CHECK_EQUAL(pairing_inner_product_precomputed<curve_type>(ip_a.begin(), ip_a.end(), ip_b_prec.begin(),
+                                                                    ip_b_prec.end()),
+                      ip_expected);
+    std::cout << " * Pairing inner product tests finished." << std::endl << std::endl;
+
     std::cout << " * Miller loop tests started..." << std::endl;
     BOOST_CHECK_EQUAL(PairingT::miller_loop(G1_prec_elements[prec_A1], G2_prec_elements[prec_B1]),
                       GT_elements[miller_loop_prec_A1_prec_B1]);
@@ -509,7 +568,90 @@ void check_pairing_operations(std::vector<Fr_value_type> &Fr_elements,
                           PairingT::miller_loop(G1_prec_elements[prec_A2], G2_prec_elements[prec_B2]),
                       PairingT::double_miller_loop(G1_prec_elements[prec_A1], G2_prec_elements[prec_B1],
                                                    G1_prec_elements[prec_A2], G2_prec_elements[prec_B2]));
+    BOOST_CHECK_EQUAL(PairingT::multi_miller_loop(G1_prec_elements, G2_prec_elements),
+                      GT_elements[double_miller_loop_prec_A1_prec_B1_prec_A2_prec_B2]);
+    BOOST_CHECK_EQUAL(
+        PairingT::multi_miller_loop({G1_prec_elements[prec_A1], G1_prec_elements[prec_A2], G1_prec_elements[prec_A1]},
+                                    {G2_prec_elements[prec_B1], G2_prec_elements[prec_B2], G2_prec_elements[prec_B1]}),
+        GT_elements[double_miller_loop_prec_A1_prec_B1_prec_A2_prec_B2] * GT_elements[miller_loop_prec_A1_prec_B1]);
+    // against the product of single Miller loops, independently of the test vectors
+    const g1_precomp_value_type prec_C1 = PairingT::precompute_g1(G1_elements[C1]);
+    const g2_precomp_value_type prec_VKz = PairingT::precompute_g2(G2_elements[VKz]);
+    const GT_value_type f1 = PairingT::miller_loop(G1_prec_elements[prec_A1], G2_prec_elements[prec_B1]);
+    const GT_value_type f2 = PairingT::miller_loop(G1_prec_elements[prec_A2], G2_prec_elements[prec_B2]);
+    const GT_value_type f3 = PairingT::miller_loop(prec_C1, prec_VKz);
+    BOOST_CHECK_EQUAL(PairingT::multi_miller_loop(G1_prec_elements, G2_prec_elements), f1 * f2);
+    BOOST_CHECK_EQUAL(PairingT::multi_miller_loop({G1_prec_elements[prec_A1], G1_prec_elements[prec_A2], prec_C1},
+                                                  {G2_prec_elements[prec_B1], G2_prec_elements[prec_B2], prec_VKz}),
+                      f1 * f2 * f3);
+    BOOST_CHECK_EQUAL(
+        PairingT::final_exponentiation(PairingT::affine_ate_miller_loop(
+            PairingT::affine_ate_precompute_g1(G1_elements[A1]), PairingT::affine_ate_precompute_g2(G2_elements[B1]))),
+        GT_elements[pair_reduceding_A1_B1]);
     std::cout << " * Miller loop tests finished." << std::endl << std::endl;
+
+    std::cout << " * G2 precomputation serialization tests started..." << std::endl;
+    typedef pairing::g2_precomp_codec<curve_type> precomp_codec;
+    typedef typename PairingT::affine_ate_g2_precomp affine_g2_precomp;
+    std::vector<std::uint8_t> prec_bytes = precomp_codec::to_bytes(G2_prec_elements[prec_B1]);
+    std::pair<bool, g2_precomp_value_type> prec_decoded = precomp_codec::template from_bytes<g2_precomp_value_type>(
+        prec_bytes.data(), prec_bytes.data() + prec_bytes.size());
+    BOOST_CHECK(prec_decoded.first);
+    BOOST_CHECK_EQUAL(prec_decoded.second, G2_prec_elements[prec_B1]);
+    BOOST_CHECK(!precomp_codec::template from_bytes<affine_g2_precomp>(prec_bytes.data(),
+                                                                       prec_bytes.data() + prec_bytes.size())
+                     .first);
+    prec_bytes.back() ^= 1;
+    BOOST_CHECK(!precomp_codec::template from_bytes<g2_precomp_value_type>(prec_bytes.data(),
+                                                                           prec_bytes.data() + prec_bytes.size())
+                     .first);
+    // well-formed file whose coefficient count does not match the loop schedule of the curve
+    g2_precomp_value_type short_prec = G2_prec_elements[prec_B1];
+    drop_last_line(short_prec);
+    prec_bytes = precomp_codec::to_bytes(short_prec);
+    BOOST_CHECK(!precomp_codec::template from_bytes<g2_precomp_value_type>(prec_bytes.data(),
+                                                                           prec_bytes.data() + prec_bytes.size())
+                     .first);
+    std::vector<std::uint8_t> affine_prec_bytes =
+        precomp_codec::to_bytes(PairingT::affine_ate_precompute_g2(G2_elements[B1]));
+    std::pair<bool, affine_g2_precomp> affine_prec_decoded = precomp_codec::template from_bytes<affine_g2_precomp>(
+        affine_prec_bytes.data(), affine_prec_bytes.data() + affine_prec_bytes.size());
+    BOOST_CHECK(affine_prec_decoded.first);
+    BOOST_CHECK_EQUAL(PairingT::final_exponentiation(PairingT::affine_ate_miller_loop(
+                          PairingT::affine_ate_precompute_g1(G1_elements[A1]), affine_prec_decoded.second)),
+                      GT_elements[pair_reduceding_A1_B1]);
+    std::cout << " * G2 precomputation serialization tests finished." << std::endl << std::endl;
+
+    std::cout << " * Pairing product tests started..." << std::endl;
+    std::vector<G1_value_type> product_a = {Fr_elements[VKx_poly] * G1_elements[A1], -G1_elements[A1],
+                                            G1_elements[A2], G1_value_type::zero()};
+    std::vector<G2_value_type> product_b = {G2_elements[B1], Fr_elements[VKx_poly] * G2_elements[B1],
+                                            G2_value_type::zero(), G2_elements[B2]};
+    BOOST_CHECK(pairing_product_is_one<curve_type>(product_a, product_b));
+    BOOST_CHECK(pairing_product_is_one<curve_type>(product_a, product_b, 2));
+    product_a[2] = G1_elements[C1];
+    product_b[2] = G2_elements[B2];
+    BOOST_CHECK(!pairing_product_is_one<curve_type>(product_a, product_b));
+    BOOST_CHECK_EQUAL(pairing_product<curve_type>(product_a, product_b, 3),
+                      PairingT::pair_reduced(G1_elements[C1], G2_elements[B2]));
+
+    g2_precomp_cache<curve_type> cache(2);
+    BOOST_CHECK_EQUAL(pair<curve_type>(G1_elements[A1], G2_elements[B1], cache), GT_elements[pairing_A1_B1]);
+    BOOST_CHECK_EQUAL(pair_reduced<curve_type>(G1_elements[A1], G2_elements[B1].doubled() - G2_elements[B1], cache),
+                      GT_elements[pair_reduceding_A1_B1]);
+    BOOST_CHECK_EQUAL(cache.misses(), 1);
+    BOOST_CHECK_EQUAL(cache.hits(), 1);
+    BOOST_CHECK(!pairing_product_is_one<curve_type>(product_a, product_b, cache, 2));
+    BOOST_CHECK_EQUAL(cache.size(), 2);
+
+    std::vector<typename PairingT::gt_type::value_type> batch = {GT_elements[pairing_A1_B1],
+                                                                  GT_elements[pairing_A2_B2],
+                                                                  GT_elements[pairing_A1_B1]};
+    batch_final_exponentiation<curve_type>(batch.begin(), batch.end(), 2);
+    BOOST_CHECK_EQUAL(batch[0], GT_elements[pair_reduceding_A1_B1]);
+    BOOST_CHECK_EQUAL(batch[1], GT_elements[pair_reduceding_A2_B2]);
+    BOOST_CHECK_EQUAL(batch[2], batch[0]);
+    std::cout << " * Pairing product tests finished." << std::endl << std::endl;
 }
 
 template<typename ElementType>
@@ -897,4 +1039,194 @@ BOOST_DATA_TEST_CASE(pairing_operation_test_mnt6_298, string_data("pairing_opera
     pairing_operation_test<pairing_policy>(data_set);
 }
 
+BOOST_AUTO_TEST_CASE(gt_torus_compression_bls12_381) {
+    using curve_type = curves::bls12<381>;
+    using bincode = nil::marshalling::curve_bincode<curve_type>;
+    using gt_value_type = typename curve_type::gt_type::value_type;
+    using gt_compressed_value_type = typename bincode::gt_compressed_value_type;
+
+    const typename curve_type::g1_type::value_type P = curve_type::g1_type::value_type::one();
+    const typename curve_type::g2_type::value_type Q = curve_type::g2_type::value_type::one();
+    const gt_value_type a = pair_reduced<curve_type>(P, Q);
+    const gt_value_type b = pair_reduced<curve_type>(P.doubled() + P, Q);
+
+    const gt_compressed_value_type a_t2 = gt_compressed_value_type::compress(a);
+    const gt_compressed_value_type b_t2 = gt_compressed_value_type::compress(b);
+    BOOST_CHECK_EQUAL(a_t2.decompress(), a);
+    BOOST_CHECK_EQUAL((a_t2 * b_t2).decompress(), a * b);
+    BOOST_CHECK_EQUAL(a_t2.inversed().decompress(), a.unitary_inversed());
+    BOOST_CHECK((a_t2 * a_t2.inversed()).is_one());
+    BOOST_CHECK(gt_compressed_value_type::compress(gt_value_type::one()).is_one());
+    BOOST_CHECK_EQUAL(gt_compressed_value_type::one().decompress(), gt_value_type::one());
+
+    std::vector<std::uint8_t> bytes(bincode::gt_compressed_octets_num);
+    BOOST_CHECK_EQUAL(bincode::gt_compressed_octets_num * 2, bincode::gt_octets_num);
+    BOOST_CHECK_EQUAL(bincode::gt_element_to_bytes_compressed(b, bytes.begin(), bytes.end()), bytes.size());
+    std::pair<bool, gt_value_type> decoded = bincode::gt_element_from_bytes_compressed(bytes.begin(), bytes.end());
+    BOOST_CHECK(decoded.first);
+    BOOST_CHECK_EQUAL(decoded.second, b);
+
+    std::fill(bytes.begin(), bytes.end(), 0xff);
+    BOOST_CHECK(!bincode::gt_compressed_from_bytes(bytes.begin(), bytes.end()).first);
+}
+
+BOOST_AUTO_TEST_CASE(gt_subgroup_check_bls12_381) {
+    using curve_type = curves::bls12<381>;
+    using gt_value_type = typename curve_type::gt_type::value_type;
+
+    const typename curve_type::g1_type::value_type P = curve_type::g1_type::value_type::one();
+    const typename curve_type::g2_type::value_type Q = curve_type::g2_type::value_type::one();
+    const gt_value_type a = pair_reduced<curve_type>(P, Q);
+    const gt_value_type unreduced = pair<curve_type>(P, Q);
+
+    // easy part of the final exponentiation only: cyclotomic, but not of order r
+    const gt_value_type x = a + gt_value_type::one();
+    const gt_value_type y = x.unitary_inversed() * x.inversed();
+    const gt_value_type cyclotomic = y.Frobenius_map(2) * y;
+
+    BOOST_CHECK(gt_subgroup_check<curve_type>(a));
+    BOOST_CHECK(gt_subgroup_check<curve_type>(gt_value_type::one()));
+    BOOST_CHECK(!gt_subgroup_check<curve_type>(unreduced));
+    BOOST_CHECK(!gt_subgroup_check<curve_type>(gt_value_type::zero()));
+    BOOST_CHECK(curve_type::pairing::cyclotomic_subgroup_check(cyclotomic));
+    BOOST_CHECK(!gt_subgroup_check<curve_type>(cyclotomic));
+
+    std::vector<gt_value_type> batch = {a, a.cyclotomic_squared(), a.unitary_inversed()};
+    BOOST_CHECK(gt_batch_subgroup_check<curve_type>(batch.begin(), batch.end()));
+    batch.emplace_back(cyclotomic);
+    BOOST_CHECK(!gt_batch_subgroup_check<curve_type>(batch.begin(), batch.end(), 2));
+    batch.back() = unreduced;
+    BOOST_CHECK(!gt_batch_subgroup_check<curve_type>(batch.begin(), batch.end()));
+}
+
+template<typename SchemeType>
+void bls_signature_test(const std::string &dst_str) {
+    using private_key_type = typename SchemeType::private_key_type;
+    using public_key_type = typename SchemeType::public_key_type;
+    using signature_type = typename SchemeType::signature_type;
+
+    const std::vector<std::uint8_t> dst(dst_str.begin(), dst_str.end());
+    const std::vector<std::vector<std::uint8_t>> msgs = {{'a', 'b', 'c'}, {'d', 'e', 'f'}, {'a', 'b', 'c'}};
+    const std::vector<private_key_type> sks = {private_key_type(7), private_key_type(11), private_key_type(13)};
+
+    std::vector<public_key_type> pks;
+    std::vector<signature_type> sigs;
+    for (std::size_t i = 0; i < sks.size(); ++i) {
+        pks.emplace_back(SchemeType::public_key(sks[i]));
+        sigs.emplace_back(SchemeType::sign(sks[i], msgs[i], dst));
+    }
+
+    BOOST_CHECK(SchemeType::verify(pks[0], msgs[0], sigs[0], dst));
+    BOOST_CHECK(!SchemeType::verify(pks[0], msgs[1], sigs[0], dst));
+    BOOST_CHECK(!SchemeType::verify(pks[1], msgs[0], sigs[0], dst));
+
+    std::vector<signature_type> same_msg_sigs;
+    for (std::size_t i = 0; i < sks.size(); ++i) {
+        same_msg_sigs.emplace_back(SchemeType::sign(sks[i], msgs[0], dst));
+    }
+    const signature_type aggregated = SchemeType::aggregate(same_msg_sigs.begin(), same_msg_sigs.end(), 2);
+    BOOST_CHECK(SchemeType::fast_aggregate_verify(pks.begin(), pks.end(), msgs[0], aggregated, dst));
+    BOOST_CHECK(!SchemeType::fast_aggregate_verify(pks.begin(), pks.end(), msgs[1], aggregated, dst));
+
+    BOOST_CHECK(SchemeType::batch_verify(pks.begin(), pks.end(), msgs.begin(), sigs.begin(), dst));
+    BOOST_CHECK(SchemeType::batch_verify(pks.begin(), pks.end(), msgs.begin(), sigs.begin(), dst, 2));
+    std::swap(sigs[0], sigs[1]);
+    BOOST_CHECK(!SchemeType::batch_verify(pks.begin(), pks.end(), msgs.begin(), sigs.begin(), dst));
+}
+
+BOOST_AUTO_TEST_CASE(pairing_alt_bn128_254) {
+    using curve_type = curves::alt_bn128_254;
+    using pairing_policy = typename curve_type::pairing;
+    using g1_value_type = typename curve_type::g1_type::value_type;
+    using g2_value_type = typename curve_type::g2_type::value_type;
+    using gt_value_type = typename curve_type::gt_type::value_type;
+    using g1_precomp = typename pairing_policy::g1_precomp;
+    using g2_precomp = typename pairing_policy::g2_precomp;
+
+    const g1_value_type P = g1_value_type::one();
+    const g2_value_type Q = g2_value_type::one();
+    const gt_value_type a = pair_reduced<curve_type>(P, Q);
+
+    // bilinearity and non-degeneracy on the generators
+    BOOST_CHECK(a != gt_value_type::one());
+    BOOST_CHECK_EQUAL(pair_reduced<curve_type>(P.doubled(), Q), a.squared());
+    BOOST_CHECK_EQUAL(pair_reduced<curve_type>(P, Q.doubled()), a.squared());
+    BOOST_CHECK_EQUAL(pair_reduced<curve_type>(P.doubled() + P, Q.doubled()), a.squared() * a.squared() * a.squared());
+
+    // negative digits of the NAF loop count add -Q
+    const g2_value_type Q7 = Q.doubled().doubled().doubled() - Q;
+    BOOST_CHECK_EQUAL(pair_reduced<curve_type>(P, -Q), a.unitary_inversed());
+    BOOST_CHECK_EQUAL(pair_reduced<curve_type>(P, Q7), a.squared().squared().squared() * a.unitary_inversed());
+
+    const g1_precomp prec_P = pairing_policy::precompute_g1(P);
+    const g1_precomp prec_P2 = pairing_policy::precompute_g1(P.doubled());
+    const g2_precomp prec_Q = pairing_policy::precompute_g2(Q);
+    const g2_precomp prec_Q7 = pairing_policy::precompute_g2(Q7);
+    const gt_value_type f = pairing_policy::miller_loop(prec_P, prec_Q);
+    const gt_value_type f2 = pairing_policy::miller_loop(prec_P2, prec_Q7);
+
+    BOOST_CHECK_EQUAL(pair<curve_type>(P, Q), f);
+    BOOST_CHECK_EQUAL(pairing_policy::final_exponentiation(f), a);
+    BOOST_CHECK_EQUAL(pairing_policy::final_exponentiation(pairing_policy::multi_miller_loop({prec_P}, {prec_Q})), a);
+    BOOST_CHECK_EQUAL(pairing_policy::double_miller_loop(prec_P, prec_Q, prec_P2, prec_Q7), f * f2);
+    BOOST_CHECK_EQUAL(pairing_policy::multi_miller_loop({prec_P, prec_P2}, {prec_Q, prec_Q7}), f * f2);
+    // three pairs take the line-times-line path for the first two and a sparse product for the third
+    BOOST_CHECK_EQUAL(pairing_policy::multi_miller_loop({prec_P, prec_P2, prec_P}, {prec_Q, prec_Q7, prec_Q}),
+                      f * f2 * f);
+    BOOST_CHECK(pairing_policy::pairing_product_is_one({prec_P, pairing_policy::precompute_g1(-P)},
+                                                       {prec_Q7, prec_Q7}));
+
+    // affine loop with the two trailing Frobenius lines
+    BOOST_CHECK_EQUAL(pairing_policy::final_exponentiation(pairing_policy::affine_ate_miller_loop(
+                          pairing_policy::affine_ate_precompute_g1(P), pairing_policy::affine_ate_precompute_g2(Q))),
+                      a);
+    BOOST_CHECK_EQUAL(pairing_policy::final_exponentiation(pairing_policy::affine_ate_miller_loop(
+                          pairing_policy::affine_ate_precompute_g1(P.doubled()),
+                          pairing_policy::affine_ate_precompute_g2(Q7))),
+                      pairing_policy::final_exponentiation(f2));
+
+    std::vector<gt_value_type> batch = {f, f2, f * f2};
+    batch_final_exponentiation<curve_type>(batch.begin(), batch.end(), 2);
+    BOOST_CHECK_EQUAL(batch[0], a);
+    BOOST_CHECK_EQUAL(batch[1], pairing_policy::final_exponentiation(f2));
+    BOOST_CHECK_EQUAL(batch[2], batch[0] * batch[1]);
+
+    // a single exponent: its digits fill the top signed window for small windows
+    using scalar_value_type = typename curve_type::scalar_field_type::value_type;
+    const std::vector<gt_value_type> gt_bases = {a};
+    for (const scalar_value_type &k : {-scalar_value_type(3), scalar_value_type(0x1234567890ABCDEFull)}) {
+        const std::vector<scalar_value_type> gt_exponents = {k};
+        const gt_value_type expected = a.pow(cpp_int(k.data));
+
+        BOOST_CHECK_EQUAL(gt_exp<curve_type>(a, k), expected);
+        BOOST_CHECK_EQUAL(gt_multiexp<curve_type>(gt_bases.begin(), gt_bases.end(), gt_exponents.begin(),
+                                                  gt_exponents.end()),
+                          expected);
+        for (std::size_t c = 2; c < 8; ++c) {
+            BOOST_CHECK_EQUAL(gt_multiexp<curve_type>(gt_bases.begin(), gt_bases.end(), gt_exponents.begin(),
+                                                      gt_exponents.end(), c),
+                              expected);
+        }
+    }
+
+    // easy part of the final exponentiation only: cyclotomic, but not of order r
+    const gt_value_type x = a + gt_value_type::one();
+    const gt_value_type y = x.unitary_inversed() * x.inversed();
+    const gt_value_type cyclotomic = y.Frobenius_map(2) * y;
+
+    BOOST_CHECK(gt_subgroup_check<curve_type>(a));
+    BOOST_CHECK(gt_subgroup_check<curve_type>(batch[1]));
+    BOOST_CHECK(gt_subgroup_check<curve_type>(gt_value_type::one()));
+    BOOST_CHECK(!gt_subgroup_check<curve_type>(f));
+    BOOST_CHECK(pairing_policy::cyclotomic_subgroup_check(cyclotomic));
+    BOOST_CHECK(!gt_subgroup_check<curve_type>(cyclotomic));
+}
+
+BOOST_AUTO_TEST_CASE(bls_signature_bls12_381) {
+    using curve_type = curves::bls12<381>;
+
+    bls_signature_test<bls_signature<bls_min_pk<curve_type>>>("BLS_SIG_BLS12381G2_XMD:SHA-256_SSWU_RO_NUL_");
+    bls_signature_test<bls_signature<bls_min_sig<curve_type>>>("BLS_SIG_BLS12381G1_XMD:SHA-256_SSWU_RO_NUL_");
+}
+
 BOOST_AUTO_TEST_SUITE_END()